@@ -26,6 +26,8 @@ public class ControllerNavigation : ModuleRules
 			new string[]
 			{
 				"Core",
+				"ControllerNavigationCore",
+				"Engine",
                 "UMG",
                 "InputCore",
 				// ... add other public dependencies that you statically link with here ...
@@ -37,7 +39,6 @@ public class ControllerNavigation : ModuleRules
 			new string[]
 			{
 				"CoreUObject",
-				"Engine",
 				"Slate",
 				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
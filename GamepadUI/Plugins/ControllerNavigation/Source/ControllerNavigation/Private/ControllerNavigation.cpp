@@ -1,6 +1,11 @@
 // Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
 
 #include "ControllerNavigation.h"
+#include "ControllerNavigationStats.h"
+#include "ControllerNavigationInputProcessor.h"
+
+#include "SlateApplication.h"
+#include "Misc/CoreDelegates.h"
 
 // Settings
 #include "Public/Config/ConNavConfig.h"
@@ -16,12 +21,30 @@ void FControllerNavigationModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	RegisterSettings();
+
+	// Slate isn't always up by the time we are loaded, so wait for the engine if we have to.
+	InputProcessor = MakeShareable( new FControllerNavigationInputProcessor() );
+	if( FSlateApplication::IsInitialized() )
+	{
+		RegisterInputProcessor();
+	}
+	else
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw( this, &FControllerNavigationModule::RegisterInputProcessor );
+	}
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	FLowLevelMemTracker::Get().RegisterProjectTag( (int32)ELLMTagControllerNavigation::ControllerNavigation, TEXT( "ControllerNavigation" ),
+												   GET_STATFNAME( STAT_ConNav_LLM ), GET_STATFNAME( STAT_ConNav_LLMSummary ) );
+#endif
 }
 
 void FControllerNavigationModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	UnregisterInputProcessor();
+
 	if( UObjectInitialized() )
 	{
 		UnregisterSettings();
@@ -33,6 +56,33 @@ bool FControllerNavigationModule::SupportsDynamicReloading()
 	return true;
 }
 
+FControllerNavigationInputProcessor* FControllerNavigationModule::GetInputProcessor()
+{
+	FControllerNavigationModule* Module = FModuleManager::GetModulePtr<FControllerNavigationModule>( "ControllerNavigation" );
+	return ( Module != nullptr ) ? Module->InputProcessor.Get() : nullptr;
+}
+
+void FControllerNavigationModule::RegisterInputProcessor()
+{
+	FCoreDelegates::OnPostEngineInit.RemoveAll( this );
+
+	if( InputProcessor.IsValid() && FSlateApplication::IsInitialized() )
+	{
+		FSlateApplication::Get().RegisterInputPreProcessor( InputProcessor );
+	}
+}
+
+void FControllerNavigationModule::UnregisterInputProcessor()
+{
+	FCoreDelegates::OnPostEngineInit.RemoveAll( this );
+
+	if( InputProcessor.IsValid() && FSlateApplication::IsInitialized() )
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor( InputProcessor );
+	}
+	InputProcessor.Reset();
+}
+
 bool FControllerNavigationModule::HandleSettingsSaved()
 {
 	UControllerNavigationConfig* config = GetMutableDefault<UControllerNavigationConfig>();
@@ -98,4 +148,19 @@ void FControllerNavigationModule::UnregisterSettings()
 	
 IMPLEMENT_MODULE( FControllerNavigationModule, ControllerNavigation )
 
-DEFINE_LOG_CATEGORY( ControllerNavigationLog );
\ No newline at end of file
+DEFINE_LOG_CATEGORY( ControllerNavigationLog );
+
+DEFINE_STAT( STAT_ConNav_GenerateNavigableWidgets );
+DEFINE_STAT( STAT_ConNav_Navigate );
+DEFINE_STAT( STAT_ConNav_NavigateToWidget );
+DEFINE_STAT( STAT_ConNav_Select );
+DEFINE_STAT( STAT_ConNav_Scroll );
+
+DEFINE_STAT( STAT_ConNav_WidgetsEnumerated );
+DEFINE_STAT( STAT_ConNav_CursorWarps );
+DEFINE_STAT( STAT_ConNav_SyntheticMouseEvents );
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+DEFINE_STAT( STAT_ConNav_LLM );
+DEFINE_STAT( STAT_ConNav_LLMSummary );
+#endif
\ No newline at end of file
@@ -0,0 +1,472 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "ControllerNavigator.h"
+
+#include "ControllerNavigation.h"
+#include "NavigationLayout.h"
+
+#include "Async/TaskGraphInterfaces.h"
+
+#include "WidgetTree.h"
+#include "UserWidget.h"
+
+#include "CanvasPanel.h"
+#include "VerticalBox.h"
+
+#include "Button.h"
+#include "ScrollBox.h"
+#include "Slider.h"
+
+/**
+* Builds synthetic menus and times the Navigator moving around them, through the same static functions games call.
+* The menus are never laid out, so their geometry is supplied through UControllerNavigator::GeometryOverride,
+* which means this runs headless, i.e. on a build agent:
+*
+*	UE4Editor-Cmd <Project> -game -nullrhi -unattended -ExecCmds="ControllerNavigation.Benchmark,Quit"
+*
+* Each menu is run with every ENavigationSearchMode, and logs the 50th/90th/99th percentile time per operation and
+* how many times the Navigator had to allocate while doing so (which should be 0, once it has seen the menu).
+* Menus large enough to be scored in parallel are then scored with 1, 2, 4... tasks, up to one per core, to show how
+* the parallel scoring scales, and that it always agrees with the serial scoring.
+*/
+class FControllerNavigationBenchmark
+{
+public:
+
+	/**
+	* Runs every scenario whose name contains the first argument, or all of them if there isn't one.
+	* @param Args The console command's arguments.
+	*/
+	static void Run( const TArray<FString>& Args );
+
+private:
+
+	/** Where a synthetic Widget sits.  Widgets inside a ScrollBox move with it. */
+	struct FBenchmarkRect
+	{
+		FVector2D	Centre;
+		FVector2D	HalfSize;
+		UScrollBox*	ScrollBox;
+	};
+
+	/** A synthetic menu. */
+	struct FBenchmarkScenario
+	{
+		FString							Name;
+		UUserWidget*					Root;
+		TMap<UWidget*, FBenchmarkRect>	Rects;
+		int32							NumWidgets;
+		bool							bScrolls;
+	};
+
+	/** The results of timing one kind of operation. */
+	struct FBenchmarkTimings
+	{
+		TArray<double>	Microseconds;
+
+		/** The number of times the Navigator's caches grew, as counted by GetNavigationAllocationCount(), not every allocation. */
+		int32			Allocations;
+	};
+
+	/** The number of untimed moves made before timing, so caches are warm. */
+	static const int32 NumWarmUpMoves = 64;
+
+	/** The number of timed moves, and scrolls, made per scenario and search mode. */
+	static const int32 NumTimedMoves = 2000;
+	static const int32 NumTimedScrolls = 200;
+
+	/** The number of timed searches made per task count, when timing the parallel scoring. */
+	static const int32 NumTimedSearches = 500;
+
+	/** Width, height and spacing of a synthetic Button. */
+	static const float ButtonWidth;
+	static const float ButtonHeight;
+	static const float ButtonSpacing;
+
+	/** @return A new, empty User Widget with a Canvas Panel at its root. */
+	static UUserWidget* CreateUserWidget( UCanvasPanel*& OutCanvas );
+
+	/** Adds a Widget of the passed class to the Panel, at the passed rect. */
+	template<typename WidgetType>
+	static WidgetType* AddWidget( FBenchmarkScenario& Scenario, UPanelWidget* Panel, const FVector2D& TopLeft, const FVector2D& Size, UScrollBox* ScrollBox = nullptr );
+
+	static void BuildGrid( FBenchmarkScenario& Scenario, int32 NumButtons );
+	static void BuildRagged( FBenchmarkScenario& Scenario, int32 NumButtons );
+	static void BuildDeep( FBenchmarkScenario& Scenario, int32 Depth );
+	static void BuildMixed( FBenchmarkScenario& Scenario, int32 GridSize );
+
+	/** Runs a single scenario with the passed search mode (and scoring, for the Linear search), logging the results. */
+	static void RunScenario( UControllerNavigator* Navigator, const FBenchmarkScenario& Scenario, ENavigationSearchMode Mode, ENavigationScoring Scoring = ENavigationScoring::NS_Legacy );
+
+	/** Times the Cone Weighted scoring of a single scenario with increasing numbers of tasks, logging the results. */
+	static void RunScoringScaling( const FBenchmarkScenario& Scenario );
+
+	/** Logs the percentiles of the passed timings. */
+	static void LogTimings( const FBenchmarkScenario& Scenario, const TCHAR* ModeName, const TCHAR* Operation, FBenchmarkTimings& Timings );
+};
+
+const float FControllerNavigationBenchmark::ButtonWidth = 120.f;
+const float FControllerNavigationBenchmark::ButtonHeight = 40.f;
+const float FControllerNavigationBenchmark::ButtonSpacing = 10.f;
+
+static FAutoConsoleCommand BenchmarkCommand(
+	TEXT( "ControllerNavigation.Benchmark" ),
+	TEXT( "Times navigating synthetic menus (grids of 10 to 10,000 Buttons, ragged rows, deep nesting, Sliders and ScrollBoxes) with every search mode.  Optionally pass part of a scenario name to only run those." ),
+	FConsoleCommandWithArgsDelegate::CreateStatic( &FControllerNavigationBenchmark::Run ) );
+
+void FControllerNavigationBenchmark::Run( const TArray<FString>& Args )
+{
+	const FString Filter = ( Args.Num() > 0 ) ? Args[0] : FString();
+
+	TArray<FBenchmarkScenario> Scenarios;
+	const int32 GridSizes[] = { 10, 100, 1000, 10000 };
+	for( int32 NumButtons : GridSizes )
+	{
+		BuildGrid( Scenarios[Scenarios.AddDefaulted()], NumButtons );
+	}
+	BuildRagged( Scenarios[Scenarios.AddDefaulted()], 1000 );
+	BuildDeep( Scenarios[Scenarios.AddDefaulted()], 64 );
+	BuildMixed( Scenarios[Scenarios.AddDefaulted()], 30 );
+
+	// Use our own Navigator, so whatever the game has pushed is left alone.
+	UControllerNavigator* PreviousNavigator = UControllerNavigator::ControllerNavigator;
+	UControllerNavigator* Navigator = NewObject<UControllerNavigator>();
+	Navigator->AddToRoot();
+	UControllerNavigator::ControllerNavigator = Navigator;
+
+	UE_LOG( ControllerNavigationLog, Display, TEXT( "%-12s %7s %-16s %-8s %10s %10s %10s %7s" ),
+			TEXT( "Scenario" ), TEXT( "Widgets" ), TEXT( "Mode" ), TEXT( "Op" ), TEXT( "p50 (us)" ), TEXT( "p90 (us)" ), TEXT( "p99 (us)" ), TEXT( "Grows" ) );
+
+	for( const FBenchmarkScenario& Scenario : Scenarios )
+	{
+		if( !Filter.IsEmpty() && !Scenario.Name.Contains( Filter ) )
+		{
+			continue;
+		}
+
+		const FBenchmarkScenario* CurScenario = &Scenario;
+		Navigator->GeometryOverride.BindLambda( [ CurScenario ]( UWidget* Widget, FVector2D& OutCentre, FVector2D& OutHalfSize )
+		{
+			const FBenchmarkRect* Rect = CurScenario->Rects.Find( Widget );
+			OutCentre = ( Rect != nullptr ) ? Rect->Centre : FVector2D::ZeroVector;
+			OutHalfSize = ( Rect != nullptr ) ? Rect->HalfSize : FVector2D::ZeroVector;
+			if( Rect != nullptr && Rect->ScrollBox != nullptr )
+			{
+				OutCentre.Y -= Rect->ScrollBox->GetScrollOffset();
+			}
+		} );
+
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_Linear );
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_Linear, ENavigationScoring::NS_NearestCentre );
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_Linear, ENavigationScoring::NS_AxisAligned );
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_Linear, ENavigationScoring::NS_ConeWeighted );
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_SpatialIndex );
+		RunScenario( Navigator, Scenario, ENavigationSearchMode::NSM_NeighbourGraph );
+
+		if( Scenario.NumWidgets >= FNavigationScoring::MinEntriesPerTask * 2 )
+		{
+			RunScoringScaling( Scenario );
+		}
+	}
+
+	UControllerNavigator::ControllerNavigator = PreviousNavigator;
+	Navigator->RemoveFromRoot();
+	Navigator->MarkPendingKill();
+
+	for( FBenchmarkScenario& Scenario : Scenarios )
+	{
+		Scenario.Root->MarkPendingKill();
+	}
+}
+
+void FControllerNavigationBenchmark::RunScenario( UControllerNavigator* Navigator, const FBenchmarkScenario& Scenario, ENavigationSearchMode Mode, ENavigationScoring Scoring )
+{
+	const TCHAR* ModeNames[] = { TEXT( "Linear" ), TEXT( "SpatialIndex" ), TEXT( "NeighbourGraph" ) };
+	const TCHAR* ScoringNames[] = { TEXT( "Linear" ), TEXT( "NearestCentre" ), TEXT( "AxisAligned" ), TEXT( "ConeWeighted" ) };
+	const TCHAR* ModeName = ( Mode == ENavigationSearchMode::NSM_Linear ) ? ScoringNames[(int32)Scoring] : ModeNames[(int32)Mode];
+
+	UControllerNavigator::SetNavigationSearchMode( Mode );
+	UControllerNavigator::SetNavigationScoring( Scoring );
+	UControllerNavigator::PushWidget( Scenario.Root );
+
+	// Same seed every run, so runs can be compared.
+	FRandomStream Random( 1234 );
+	const auto MoveRandomly = [ &Random ]()
+	{
+		switch( Random.RandRange( 0, 3 ) )
+		{
+			case 0:		UControllerNavigator::Up( false );		break;
+			case 1:		UControllerNavigator::Down( false );	break;
+			case 2:		UControllerNavigator::Left( false );	break;
+			default:	UControllerNavigator::Right( false );	break;
+		}
+	};
+
+	for( int32 i = 0; i < NumWarmUpMoves; ++i )
+	{
+		MoveRandomly();
+	}
+
+	// Time the Neighbour Graph itself, not the Linear search used while it builds in the background.
+	if( Navigator->Layers.Num() > 0 )
+	{
+		Navigator->Layers.Last().Geometry.WaitForGraph();
+	}
+
+	FBenchmarkTimings MoveTimings;
+	MoveTimings.Microseconds.Reserve( NumTimedMoves );
+	const int32 MoveAllocationsBefore = Navigator->NavigationAllocations;
+	for( int32 i = 0; i < NumTimedMoves; ++i )
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		MoveRandomly();
+		MoveTimings.Microseconds.Add( FPlatformTime::ToMilliseconds64( FPlatformTime::Cycles64() - StartCycles ) * 1000.0 );
+	}
+	MoveTimings.Allocations = Navigator->NavigationAllocations - MoveAllocationsBefore;
+	LogTimings( Scenario, ModeName, TEXT( "Move" ), MoveTimings );
+
+	if( Scenario.bScrolls )
+	{
+		// Scroll back and forth, moving once after each so the scrolled geometry is recaptured.
+		FBenchmarkTimings ScrollTimings;
+		ScrollTimings.Microseconds.Reserve( NumTimedScrolls );
+		const int32 ScrollAllocationsBefore = Navigator->NavigationAllocations;
+		for( int32 i = 0; i < NumTimedScrolls; ++i )
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			UControllerNavigator::Scroll( ( ( i / 10 ) % 2 == 0 ) ? 1.f : -1.f, 20.f, false );
+			MoveRandomly();
+			ScrollTimings.Microseconds.Add( FPlatformTime::ToMilliseconds64( FPlatformTime::Cycles64() - StartCycles ) * 1000.0 );
+		}
+		ScrollTimings.Allocations = Navigator->NavigationAllocations - ScrollAllocationsBefore;
+		LogTimings( Scenario, ModeName, TEXT( "Scroll" ), ScrollTimings );
+	}
+
+	UControllerNavigator::PopWidget();
+}
+
+void FControllerNavigationBenchmark::RunScoringScaling( const FBenchmarkScenario& Scenario )
+{
+	// Score the rects directly, so we are only timing the scoring.
+	FNavigationLayout Layout;
+	Layout.Reset( Scenario.Rects.Num() );
+	for( const TPair<UWidget*, FBenchmarkRect>& Pair : Scenario.Rects )
+	{
+		Layout.Add( Pair.Value.Centre, Pair.Value.HalfSize, FNavigationSnapshot::Flag_Target | FNavigationSnapshot::Flag_HasGeometry );
+	}
+	Layout.Build( false );
+	const FNavigationSnapshot& Snapshot = Layout.GetSnapshot();
+
+	// Every task count searches the same moves, and must agree with the serial search.
+	FRandomStream Random( 4321 );
+	TArray<int32> FromIndices;
+	TArray<int32> Directions;
+	TArray<int32> SerialTargets;
+	for( int32 i = 0; i < NumTimedSearches; ++i )
+	{
+		FromIndices.Add( Random.RandRange( 0, Snapshot.Num() - 1 ) );
+		Directions.Add( Random.RandRange( 0, FNavigationGraph::NumDirections - 1 ) );
+	}
+
+	// 1, 2, 4... tasks, then one per core (the workers plus this thread).
+	const int32 MaxTasks = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	TArray<int32> TaskCounts;
+	for( int32 NumTasks = 1; NumTasks < MaxTasks; NumTasks *= 2 )
+	{
+		TaskCounts.Add( NumTasks );
+	}
+	TaskCounts.Add( MaxTasks );
+
+	for( int32 NumTasks : TaskCounts )
+	{
+		// A threshold of 0 always scores in parallel, and MAX_int32 never does.
+		const int32 ParallelThreshold = ( NumTasks > 1 ) ? 0 : MAX_int32;
+
+		FBenchmarkTimings Timings;
+		Timings.Microseconds.Reserve( NumTimedSearches );
+		Timings.Allocations = 0;
+
+		int32 NumMismatches = 0;
+		for( int32 i = 0; i < NumTimedSearches; ++i )
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			const int32 Target = FNavigationScoring::FindNeighbour( Snapshot, FromIndices[i], Directions[i], ENavigationLayoutScoring::ConeWeighted, 0.f, ParallelThreshold, NumTasks );
+			Timings.Microseconds.Add( FPlatformTime::ToMilliseconds64( FPlatformTime::Cycles64() - StartCycles ) * 1000.0 );
+
+			if( NumTasks == 1 )
+			{
+				SerialTargets.Add( Target );
+			}
+			else if( Target != SerialTargets[i] )
+			{
+				++NumMismatches;
+			}
+		}
+
+		LogTimings( Scenario, *FString::Printf( TEXT( "Cone x%d tasks" ), NumTasks ), TEXT( "Score" ), Timings );
+
+		if( NumMismatches > 0 )
+		{
+			UE_LOG( ControllerNavigationLog, Error, TEXT( "%s: %d of %d searches with %d tasks picked a different Widget to the serial search." ),
+					*Scenario.Name, NumMismatches, NumTimedSearches, NumTasks );
+		}
+	}
+}
+
+void FControllerNavigationBenchmark::LogTimings( const FBenchmarkScenario& Scenario, const TCHAR* ModeName, const TCHAR* Operation, FBenchmarkTimings& Timings )
+{
+	Timings.Microseconds.Sort();
+
+	const auto Percentile = [ &Timings ]( float Fraction )
+	{
+		const int32 Index = FMath::Min( FMath::FloorToInt( Fraction * Timings.Microseconds.Num() ), Timings.Microseconds.Num() - 1 );
+		return ( Index >= 0 ) ? Timings.Microseconds[Index] : 0.0;
+	};
+
+	UE_LOG( ControllerNavigationLog, Display, TEXT( "%-12s %7d %-16s %-8s %10.2f %10.2f %10.2f %7d" ),
+			*Scenario.Name, Scenario.NumWidgets, ModeName, Operation, Percentile( .5f ), Percentile( .9f ), Percentile( .99f ), Timings.Allocations );
+}
+
+UUserWidget* FControllerNavigationBenchmark::CreateUserWidget( UCanvasPanel*& OutCanvas )
+{
+	UUserWidget* Widget = NewObject<UUserWidget>( GetTransientPackage(), NAME_None, RF_Transient );
+	Widget->WidgetTree = NewObject<UWidgetTree>( Widget, TEXT( "WidgetTree" ), RF_Transient );
+
+	OutCanvas = Widget->WidgetTree->ConstructWidget<UCanvasPanel>();
+	Widget->WidgetTree->RootWidget = OutCanvas;
+
+	return Widget;
+}
+
+template<typename WidgetType>
+WidgetType* FControllerNavigationBenchmark::AddWidget( FBenchmarkScenario& Scenario, UPanelWidget* Panel, const FVector2D& TopLeft, const FVector2D& Size, UScrollBox* ScrollBox )
+{
+	UWidgetTree* WidgetTree = Cast<UWidgetTree>( Panel->GetOuter() );
+	WidgetType* Widget = WidgetTree->ConstructWidget<WidgetType>();
+	Panel->AddChild( Widget );
+
+	FBenchmarkRect& Rect = Scenario.Rects.Add( Widget );
+	Rect.HalfSize = Size * .5f;
+	Rect.Centre = TopLeft + Rect.HalfSize;
+	Rect.ScrollBox = ScrollBox;
+
+	++Scenario.NumWidgets;
+	return Widget;
+}
+
+void FControllerNavigationBenchmark::BuildGrid( FBenchmarkScenario& Scenario, int32 NumButtons )
+{
+	UCanvasPanel* Canvas = nullptr;
+	Scenario.Name = FString::Printf( TEXT( "Grid%d" ), NumButtons );
+	Scenario.Root = CreateUserWidget( Canvas );
+	Scenario.NumWidgets = 0;
+	Scenario.bScrolls = false;
+
+	const int32 NumColumns = FMath::CeilToInt( FMath::Sqrt( (float)NumButtons ) );
+	for( int32 i = 0; i < NumButtons; ++i )
+	{
+		const FVector2D TopLeft( ( i % NumColumns ) * ( ButtonWidth + ButtonSpacing ), ( i / NumColumns ) * ( ButtonHeight + ButtonSpacing ) );
+		AddWidget<UButton>( Scenario, Canvas, TopLeft, FVector2D( ButtonWidth, ButtonHeight ) );
+	}
+}
+
+void FControllerNavigationBenchmark::BuildRagged( FBenchmarkScenario& Scenario, int32 NumButtons )
+{
+	UCanvasPanel* Canvas = nullptr;
+	Scenario.Name = TEXT( "Ragged" );
+	Scenario.Root = CreateUserWidget( Canvas );
+	Scenario.NumWidgets = 0;
+	Scenario.bScrolls = false;
+
+	// Rows of differing lengths, made of Buttons of differing widths, so nothing lines up.
+	FRandomStream Random( 5678 );
+	float Y = 0.f;
+	while( Scenario.NumWidgets < NumButtons )
+	{
+		float X = Random.FRandRange( 0.f, ButtonWidth );
+		const int32 NumInRow = FMath::Min( Random.RandRange( 1, 20 ), NumButtons - Scenario.NumWidgets );
+		for( int32 i = 0; i < NumInRow; ++i )
+		{
+			const float Width = Random.FRandRange( ButtonWidth * .25f, ButtonWidth * 2.f );
+			AddWidget<UButton>( Scenario, Canvas, FVector2D( X, Y ), FVector2D( Width, ButtonHeight ) );
+			X += Width + Random.FRandRange( 0.f, ButtonSpacing * 4.f );
+		}
+		Y += ButtonHeight + Random.FRandRange( ButtonSpacing, ButtonSpacing * 4.f );
+	}
+}
+
+void FControllerNavigationBenchmark::BuildDeep( FBenchmarkScenario& Scenario, int32 Depth )
+{
+	UCanvasPanel* Canvas = nullptr;
+	Scenario.Name = TEXT( "Deep" );
+	Scenario.Root = CreateUserWidget( Canvas );
+	Scenario.NumWidgets = 0;
+	Scenario.bScrolls = false;
+
+	// Every level is a User Widget holding a Vertical Box, holding a row of Buttons and the next level down.
+	const int32 NumButtonsPerLevel = 4;
+	UPanelWidget* Parent = Canvas;
+	for( int32 Level = 0; Level < Depth; ++Level )
+	{
+		UCanvasPanel* LevelCanvas = nullptr;
+		UUserWidget* LevelWidget = CreateUserWidget( LevelCanvas );
+		Parent->AddChild( LevelWidget );
+
+		UVerticalBox* Box = LevelWidget->WidgetTree->ConstructWidget<UVerticalBox>();
+		LevelCanvas->AddChild( Box );
+
+		for( int32 i = 0; i < NumButtonsPerLevel; ++i )
+		{
+			const FVector2D TopLeft( i * ( ButtonWidth + ButtonSpacing ), Level * ( ButtonHeight + ButtonSpacing ) );
+			AddWidget<UButton>( Scenario, Box, TopLeft, FVector2D( ButtonWidth, ButtonHeight ) );
+		}
+
+		Parent = Box;
+	}
+}
+
+void FControllerNavigationBenchmark::BuildMixed( FBenchmarkScenario& Scenario, int32 GridSize )
+{
+	UCanvasPanel* Canvas = nullptr;
+	Scenario.Name = TEXT( "Mixed" );
+	Scenario.Root = CreateUserWidget( Canvas );
+	Scenario.NumWidgets = 0;
+	Scenario.bScrolls = true;
+
+	// A grid of Buttons with every third a Slider...
+	for( int32 Row = 0; Row < GridSize; ++Row )
+	{
+		for( int32 Column = 0; Column < GridSize; ++Column )
+		{
+			const FVector2D TopLeft( Column * ( ButtonWidth + ButtonSpacing ), Row * ( ButtonHeight + ButtonSpacing ) );
+			if( ( Row * GridSize + Column ) % 3 == 2 )
+			{
+				AddWidget<USlider>( Scenario, Canvas, TopLeft, FVector2D( ButtonWidth, ButtonHeight ) );
+			}
+			else
+			{
+				AddWidget<UButton>( Scenario, Canvas, TopLeft, FVector2D( ButtonWidth, ButtonHeight ) );
+			}
+		}
+	}
+
+	// ...beside a few ScrollBoxes of Buttons.
+	const int32 NumScrollBoxes = 4;
+	const int32 NumButtonsPerScrollBox = 50;
+	const float ScrollBoxLeft = GridSize * ( ButtonWidth + ButtonSpacing );
+	const float ScrollBoxHeight = 10 * ( ButtonHeight + ButtonSpacing );
+	for( int32 i = 0; i < NumScrollBoxes; ++i )
+	{
+		const FVector2D ScrollBoxTopLeft( ScrollBoxLeft + i * ( ButtonWidth + ButtonSpacing ), 0.f );
+		UScrollBox* ScrollBox = AddWidget<UScrollBox>( Scenario, Canvas, ScrollBoxTopLeft, FVector2D( ButtonWidth, ScrollBoxHeight ) );
+
+		// The ScrollBox only keeps its offset once its Slate Widget exists.
+		ScrollBox->TakeWidget();
+
+		for( int32 j = 0; j < NumButtonsPerScrollBox; ++j )
+		{
+			const FVector2D TopLeft( ScrollBoxTopLeft.X, j * ( ButtonHeight + ButtonSpacing ) );
+			AddWidget<UButton>( Scenario, ScrollBox, TopLeft, FVector2D( ButtonWidth, ButtonHeight ), ScrollBox );
+		}
+	}
+}
@@ -0,0 +1,113 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "ControllerNavigationInputProcessor.h"
+
+#include "ControllerNavigation.h"
+
+#include "SlateApplication.h"
+
+namespace
+{
+	/** @return True if the User is typing, i.e. Select has focused an Editable Text Box for them. */
+	bool IsEditingText( const FSlateApplication& SlateApp, int32 UserIndex )
+	{
+		static const FName EditableTextType( TEXT( "SEditableText" ) );
+		static const FName MultiLineEditableTextType( TEXT( "SMultiLineEditableText" ) );
+
+		TSharedPtr<SWidget> FocusedWidget = SlateApp.GetUserFocusedWidget( UserIndex );
+		return FocusedWidget.IsValid() && ( FocusedWidget->GetType() == EditableTextType || FocusedWidget->GetType() == MultiLineEditableTextType );
+	}
+}
+
+FControllerNavigationInputProcessor::FControllerNavigationInputProcessor()
+	: bEnabled( false )
+	, bLoop( false )
+{
+	ResetKeys();
+}
+
+void FControllerNavigationInputProcessor::Tick( const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor )
+{
+}
+
+bool FControllerNavigationInputProcessor::HandleKeyDownEvent( FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent )
+{
+	if( !bEnabled )
+	{
+		return false;
+	}
+
+	const ENavigationInputAction* Action = KeyMap.Find( InKeyEvent.GetKey() );
+	if( Action == nullptr )
+	{
+		return false;
+	}
+
+	// While typing, the Arrow keys move the caret and Enter commits the text, so leave every key to the text.
+	// Committing clears the text's focus, which hands the keys back to us.
+	if( IsEditingText( SlateApp, InKeyEvent.GetUserIndex() ) )
+	{
+		return false;
+	}
+
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForUserIndex( InKeyEvent.GetUserIndex() );
+	if( Navigator == nullptr )
+	{
+		return false;
+	}
+
+	// Returning true stops Slate routing the key any further, i.e. to its own focus navigation.
+	return Navigator->HandleNavigationInput( *Action, bLoop, InKeyEvent.IsRepeat() );
+}
+
+bool FControllerNavigationInputProcessor::HandleMouseMoveEvent( FSlateApplication& SlateApp, const FPointerEvent& MouseEvent )
+{
+	// Only the first Player has a cursor.  Never consumed, the Mouse should always reach the Widgets.
+	// Every Mouse move comes through here, so don't create the Navigator just to tell it; without Layers it has nothing to track.
+	UControllerNavigator* Navigator = UControllerNavigator::ControllerNavigator;
+	if( Navigator != nullptr && Navigator->Layers.Num() > 0 )
+	{
+		Navigator->HandleMouseMove( MouseEvent.GetScreenSpacePosition(), MouseEvent.GetCursorDelta() );
+	}
+	return false;
+}
+
+void FControllerNavigationInputProcessor::SetEnabled( bool bInEnabled, bool bInLoop )
+{
+	bEnabled = bInEnabled;
+	bLoop = bInLoop;
+}
+
+void FControllerNavigationInputProcessor::BindKey( const FKey& Key, ENavigationInputAction Action )
+{
+	KeyMap.Add( Key, Action );
+}
+
+void FControllerNavigationInputProcessor::UnbindKey( const FKey& Key )
+{
+	KeyMap.Remove( Key );
+}
+
+void FControllerNavigationInputProcessor::ResetKeys()
+{
+	KeyMap.Reset();
+
+	BindKey( EKeys::Gamepad_DPad_Up, ENavigationInputAction::NIA_Up );
+	BindKey( EKeys::Gamepad_LeftStick_Up, ENavigationInputAction::NIA_Up );
+	BindKey( EKeys::Up, ENavigationInputAction::NIA_Up );
+
+	BindKey( EKeys::Gamepad_DPad_Down, ENavigationInputAction::NIA_Down );
+	BindKey( EKeys::Gamepad_LeftStick_Down, ENavigationInputAction::NIA_Down );
+	BindKey( EKeys::Down, ENavigationInputAction::NIA_Down );
+
+	BindKey( EKeys::Gamepad_DPad_Left, ENavigationInputAction::NIA_Left );
+	BindKey( EKeys::Gamepad_LeftStick_Left, ENavigationInputAction::NIA_Left );
+	BindKey( EKeys::Left, ENavigationInputAction::NIA_Left );
+
+	BindKey( EKeys::Gamepad_DPad_Right, ENavigationInputAction::NIA_Right );
+	BindKey( EKeys::Gamepad_LeftStick_Right, ENavigationInputAction::NIA_Right );
+	BindKey( EKeys::Right, ENavigationInputAction::NIA_Right );
+
+	BindKey( EKeys::Gamepad_FaceButton_Bottom, ENavigationInputAction::NIA_Select );
+	BindKey( EKeys::Enter, ENavigationInputAction::NIA_Select );
+}
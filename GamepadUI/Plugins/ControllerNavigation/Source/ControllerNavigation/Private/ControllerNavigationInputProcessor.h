@@ -0,0 +1,59 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "Framework/Application/IInputProcessor.h"
+
+#include "ControllerNavigator.h"
+
+/**
+* Navigates straight from Slate's input, before it is routed to any Widget, so a move lands in the same frame as the
+* key press and never goes through Blueprint.  Each Slate User's keys only move that User's Navigator.
+* The module registers it with Slate, but it ignores everything until UControllerNavigator::SetNativeInputEnabled().
+* It also passes every Mouse move to the first Player's Navigator, which ignores them unless Mouse Tracking is on.
+*/
+class FControllerNavigationInputProcessor : public IInputProcessor
+{
+public:
+	FControllerNavigationInputProcessor();
+
+	// IInputProcessor
+	virtual void							Tick( const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor ) override;
+	virtual bool							HandleKeyDownEvent( FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent ) override;
+	virtual bool							HandleMouseMoveEvent( FSlateApplication& SlateApp, const FPointerEvent& MouseEvent ) override;
+
+	/**
+	* @param bInEnabled True to navigate from the mapped keys, false to ignore them.
+	* @param bInLoop If true, directional keys loop round to the opposite side.
+	*/
+	void									SetEnabled( bool bInEnabled, bool bInLoop );
+
+	/**
+	* Maps the Key to the Action, replacing anything it was mapped to before.
+	* @param Key The Keyboard or Gamepad key.
+	* @param Action The navigation Action to perform when it is pressed.
+	*/
+	void									BindKey( const FKey& Key, ENavigationInputAction Action );
+
+	/**
+	* Stops the Key from navigating, letting Slate route it as usual.
+	* @param Key The Keyboard or Gamepad key.
+	*/
+	void									UnbindKey( const FKey& Key );
+
+	/** Restores the default mapping: the D-Pad, Left Stick and Arrow keys navigate, the bottom Face Button and Enter select. */
+	void									ResetKeys();
+
+private:
+
+	/** If false, every key is left for Slate to route. */
+	bool									bEnabled;
+
+	/** If true, directional keys loop round to the opposite side. */
+	bool									bLoop;
+
+	/** The keys we navigate with, and what each of them does. */
+	TMap<FKey, ENavigationInputAction>		KeyMap;
+};
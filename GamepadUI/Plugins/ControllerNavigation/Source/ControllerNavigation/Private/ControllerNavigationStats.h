@@ -0,0 +1,46 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Declares STATGROUP_ControllerNavigation, and the stats counted by the navigation algorithms.
+#include "NavigationCoreStats.h"
+
+// Everything here shows up under "stat ControllerNavigation", and the cycle stats as CPU events in Unreal Insights.
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "GenerateNavigableWidgets" ), STAT_ConNav_GenerateNavigableWidgets, STATGROUP_ControllerNavigation, );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Navigate" ), STAT_ConNav_Navigate, STATGROUP_ControllerNavigation, );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "NavigateToWidget" ), STAT_ConNav_NavigateToWidget, STATGROUP_ControllerNavigation, );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Select" ), STAT_ConNav_Select, STATGROUP_ControllerNavigation, );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "Scroll" ), STAT_ConNav_Scroll, STATGROUP_ControllerNavigation, );
+
+// Per frame counts.
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Widgets Enumerated" ), STAT_ConNav_WidgetsEnumerated, STATGROUP_ControllerNavigation, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Cursor Warps" ), STAT_ConNav_CursorWarps, STATGROUP_ControllerNavigation, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Synthetic Mouse Events" ), STAT_ConNav_SyntheticMouseEvents, STATGROUP_ControllerNavigation, );
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+
+// LLM has a range of tags reserved for projects.  If your project already uses the first of them, define this to move ours.
+#ifndef CONTROLLERNAVIGATION_LLM_TAG_OFFSET
+#define CONTROLLERNAVIGATION_LLM_TAG_OFFSET 0
+#endif
+
+/** The Low Level Memory tag everything the Navigator allocates is tracked under. */
+enum class ELLMTagControllerNavigation : LLM_TAG_TYPE
+{
+	ControllerNavigation = (LLM_TAG_TYPE)ELLMTag::ProjectTagStart + CONTROLLERNAVIGATION_LLM_TAG_OFFSET,
+};
+
+DECLARE_LLM_MEMORY_STAT_EXTERN( TEXT( "ControllerNavigation" ), STAT_ConNav_LLM, STATGROUP_LLMFULL, );
+DECLARE_LLM_MEMORY_STAT_EXTERN( TEXT( "ControllerNavigation" ), STAT_ConNav_LLMSummary, STATGROUP_LLM, );
+
+#define LLM_SCOPE_CONTROLLERNAVIGATION() LLM_SCOPE( (ELLMTag)ELLMTagControllerNavigation::ControllerNavigation )
+
+#else
+
+#define LLM_SCOPE_CONTROLLERNAVIGATION()
+
+#endif
@@ -0,0 +1,46 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "ControllerNavigationSubsystem.h"
+
+#include "ControllerNavigation.h"
+#include "ControllerNavigator.h"
+
+#include "SlateApplication.h"
+
+void UControllerNavigationSubsystem::Initialize( FSubsystemCollectionBase& Collection )
+{
+	Super::Initialize( Collection );
+
+	ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	UGameInstance* GameInstance = ( LocalPlayer != nullptr ) ? LocalPlayer->GetGameInstance() : nullptr;
+	if( GameInstance == nullptr || GameInstance->GetFirstGamePlayer() == LocalPlayer )
+	{
+		// The first Player keeps the singleton, along with anything pushed to it before they were added.
+		Navigator = UControllerNavigator::GetInstance();
+	}
+	else
+	{
+		// Everyone else shares the first Player's cursor, so they navigate by focus alone.
+		Navigator = NewObject<UControllerNavigator>( this );
+		Navigator->bOwnsCursor = false;
+		Navigator->bCursorlessNavigation = true;
+	}
+
+	// Input events are tagged with the Slate User, so this is how they find their way to us.
+	if( LocalPlayer != nullptr && FSlateApplication::IsInitialized() )
+	{
+		Navigator->SlateUserIndex = FSlateApplication::Get().GetUserIndexForController( LocalPlayer->GetControllerId() );
+	}
+}
+
+void UControllerNavigationSubsystem::Deinitialize()
+{
+	// The singleton outlives us, so don't leave our Player's Widgets on it.  Our own Navigator is just collected.
+	if( Navigator != nullptr && Navigator == UControllerNavigator::ControllerNavigator )
+	{
+		UControllerNavigator::RemoveAllWidgets();
+	}
+	Navigator = nullptr;
+
+	Super::Deinitialize();
+}
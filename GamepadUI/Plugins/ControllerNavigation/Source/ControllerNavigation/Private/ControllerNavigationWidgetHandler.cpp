@@ -0,0 +1,284 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "ControllerNavigationWidgetHandler.h"
+
+#include "ControllerNavigator.h"
+
+#include "PanelWidget.h"
+#include "UserWidget.h"
+
+#include "SlateApplication.h"
+
+#include "Button.h"
+#include "CheckBox.h"
+#include "ComboBoxString.h"
+#include "EditableTextBox.h"
+#include "ListView.h"
+#include "ScrollBox.h"
+#include "Slider.h"
+#include "SpinBox.h"
+
+#include "SComboBox.h"
+#include "SListView.h"
+
+namespace
+{
+	class FButtonHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool IsNavigable( UWidget* Widget ) const override
+		{
+			// "Focusable" unticked in the editor.  Read from the property, so the Slate Widget isn't built just to ask it.
+			return CastChecked<UButton>( Widget )->IsFocusable;
+		}
+
+		virtual bool Activate( UWidget* Widget, int32 SlateUserIndex ) const override
+		{
+			UButton* Button = CastChecked<UButton>( Widget );
+
+			// The same events, in the same order, as a click.
+			Button->OnPressed.Broadcast();
+			Button->OnReleased.Broadcast();
+			Button->OnClicked.Broadcast();
+			return true;
+		}
+	};
+
+	class FCheckBoxHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool Activate( UWidget* Widget, int32 SlateUserIndex ) const override
+		{
+			UCheckBox* CheckBox = CastChecked<UCheckBox>( Widget );
+
+			// Undetermined toggles to Checked, as it does when clicked.
+			CheckBox->SetIsChecked( !CheckBox->IsChecked() );
+			CheckBox->OnCheckStateChanged.Broadcast( CheckBox->IsChecked() );
+			return true;
+		}
+	};
+
+	class FComboBoxStringHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool Activate( UWidget* Widget, int32 SlateUserIndex ) const override
+		{
+			TSharedPtr<SWidget> SlateWidget = Widget->GetCachedWidget();
+			if( !SlateWidget.IsValid() )
+			{
+				return false;
+			}
+
+			// UComboBoxString's Slate Widget is always an SComboBox, which opens like any other Menu Anchor.
+			StaticCastSharedPtr<SComboBox<TSharedPtr<FString>>>( SlateWidget )->SetIsOpen( true );
+			return true;
+		}
+	};
+
+	class FListViewHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual void OnNavigatedTo( UWidget* Widget ) const override
+		{
+			// Lists are navigated by item, so make sure there is one to start from.
+			UListView* ListView = CastChecked<UListView>( Widget );
+			if( ListView->GetSelectedItem() == nullptr && ListView->GetNumItems() > 0 )
+			{
+				ListView->SetSelectedIndex( 0 );
+				ListView->NavigateToIndex( 0 );
+			}
+		}
+
+		virtual bool Activate( UWidget* Widget, int32 SlateUserIndex ) const override
+		{
+			UListView* ListView = CastChecked<UListView>( Widget );
+			UObject* Item = ListView->GetSelectedItem();
+			TSharedPtr<SWidget> SlateWidget = ListView->GetCachedWidget();
+			if( Item == nullptr || !SlateWidget.IsValid() )
+			{
+				return false;
+			}
+
+			// The same path as clicking the item's row, so OnItemClicked is broadcast for the selected item, wherever the cursor is.
+			// UListView's (and UTileView's) Slate Widget is always an SListView of its items.
+			StaticCastSharedPtr<SListView<UObject*>>( SlateWidget )->Private_OnItemClicked( Item );
+			return true;
+		}
+
+		virtual UWidget* GetHighlightWidget( UWidget* Widget ) const override
+		{
+			// The selected item's entry, once the List has generated it, rather than the middle of the List.
+			UListView* ListView = CastChecked<UListView>( Widget );
+			UObject* Item = ListView->GetSelectedItem();
+			UUserWidget* Entry = ( Item != nullptr ) ? ListView->GetEntryWidgetFromItem( Item ) : nullptr;
+			return ( Entry != nullptr ) ? Entry : Widget;
+		}
+	};
+
+	class FScrollBoxHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		/** ScrollBoxes are scrolled, not navigated to, but are kept with the navigable Widgets so Scroll() can find them. */
+		virtual bool IsTarget() const override { return false; }
+	};
+
+	class FSliderHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool IsAdjustable() const override { return true; }
+
+		virtual bool GetAdjustableValue( UWidget* Widget, FControllerNavigationAdjustableValue& OutValue ) const override
+		{
+			USlider* Slider = CastChecked<USlider>( Widget );
+			OutValue.Value = Slider->GetValue();
+			OutValue.MinValue = FMath::Min( Slider->MinValue, Slider->MaxValue );
+			OutValue.MaxValue = FMath::Max( Slider->MinValue, Slider->MaxValue );
+			OutValue.StepSize = FMath::Max( Slider->StepSize, 0.f );
+			OutValue.Span = OutValue.MaxValue - OutValue.MinValue;
+			return OutValue.Span > 0.f;
+		}
+
+		virtual void SetAdjustableValue( UWidget* Widget, float Value ) const override
+		{
+			USlider* Slider = CastChecked<USlider>( Widget );
+			Slider->SetValue( Value );
+			Slider->OnValueChanged.Broadcast( Value );
+		}
+
+		virtual void OnHover( UControllerNavigator* Navigator, UWidget* Widget, bool bHovered ) const override
+		{
+			// MJ: 23/03/2018
+			// This process allows us to handle "hover" when used via this Plugin, but not generic
+			// mouse movements.
+			// If this becomes an issue, due to inconsistencies in UX, then consider creating an
+			// extended SSlider and USlider that implement an actual Un/Hover event system.
+			if( Navigator->OnSliderHover.IsBound() )
+			{
+				Navigator->OnSliderHover.Broadcast( CastChecked<USlider>( Widget ), bHovered );
+			}
+		}
+	};
+
+	class FSpinBoxHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool IsAdjustable() const override { return true; }
+
+		virtual bool GetAdjustableValue( UWidget* Widget, FControllerNavigationAdjustableValue& OutValue ) const override
+		{
+			USpinBox* SpinBox = CastChecked<USpinBox>( Widget );
+			OutValue.Value = SpinBox->GetValue();
+			OutValue.MinValue = SpinBox->GetMinValue();
+			OutValue.MaxValue = SpinBox->GetMaxValue();
+			OutValue.StepSize = FMath::Max( SpinBox->Delta, 0.f );
+
+			// Slide across the range the mouse drags over, if there is one, otherwise the whole range, if that is bounded.
+			// Unset bounds are the lowest and highest floats.
+			const auto IsBounded = []( float Min, float Max )
+			{
+				return Min > TNumericLimits<float>::Lowest() && Max < TNumericLimits<float>::Max() && Max > Min;
+			};
+			if( IsBounded( SpinBox->GetMinSliderValue(), SpinBox->GetMaxSliderValue() ) )
+			{
+				OutValue.Span = SpinBox->GetMaxSliderValue() - SpinBox->GetMinSliderValue();
+			}
+			else if( IsBounded( OutValue.MinValue, OutValue.MaxValue ) )
+			{
+				OutValue.Span = OutValue.MaxValue - OutValue.MinValue;
+			}
+			else
+			{
+				OutValue.Span = ( OutValue.StepSize > 0.f ) ? OutValue.StepSize * 10.f : 10.f;
+			}
+
+			return OutValue.MaxValue > OutValue.MinValue;
+		}
+
+		virtual void SetAdjustableValue( UWidget* Widget, float Value ) const override
+		{
+			USpinBox* SpinBox = CastChecked<USpinBox>( Widget );
+			SpinBox->SetValue( Value );
+			SpinBox->OnValueChanged.Broadcast( Value );
+		}
+	};
+
+	class FEditableTextBoxHandler : public FControllerNavigationWidgetHandler
+	{
+	public:
+		virtual bool Activate( UWidget* Widget, int32 SlateUserIndex ) const override
+		{
+			TSharedPtr<SWidget> SlateWidget = Widget->GetCachedWidget();
+			if( !SlateWidget.IsValid() || !FSlateApplication::IsInitialized() )
+			{
+				return false;
+			}
+
+			// Focusing the box starts text entry (and brings up the on-screen keyboard, on platforms that have one).
+			FSlateApplication::Get().SetUserFocus( SlateUserIndex, SlateWidget, EFocusCause::Navigation );
+			return true;
+		}
+	};
+}
+
+FControllerNavigationWidgetRegistry& FControllerNavigationWidgetRegistry::Get()
+{
+	static FControllerNavigationWidgetRegistry Registry;
+	return Registry;
+}
+
+FControllerNavigationWidgetRegistry::FControllerNavigationWidgetRegistry()
+{
+	Register( UButton::StaticClass(), MakeShared<FButtonHandler>() );
+	Register( UCheckBox::StaticClass(), MakeShared<FCheckBoxHandler>() );
+	Register( UComboBoxString::StaticClass(), MakeShared<FComboBoxStringHandler>() );
+	Register( UEditableTextBox::StaticClass(), MakeShared<FEditableTextBoxHandler>() );
+	Register( UListView::StaticClass(), MakeShared<FListViewHandler>() );
+	Register( UScrollBox::StaticClass(), MakeShared<FScrollBoxHandler>() );
+	Register( USlider::StaticClass(), MakeShared<FSliderHandler>() );
+	Register( USpinBox::StaticClass(), MakeShared<FSpinBoxHandler>() );
+}
+
+void FControllerNavigationWidgetRegistry::Register( const UClass* WidgetClass, TSharedRef<FControllerNavigationWidgetHandler> Handler )
+{
+	check( WidgetClass != nullptr && WidgetClass->IsChildOf( UWidget::StaticClass() ) );
+
+	Handlers.Add( FObjectKey( WidgetClass ), Handler );
+
+	// Subclasses may have been cached with their super class's handler.
+	ClassCache.Reset();
+}
+
+void FControllerNavigationWidgetRegistry::Unregister( const UClass* WidgetClass )
+{
+	Handlers.Remove( FObjectKey( WidgetClass ) );
+	ClassCache.Reset();
+}
+
+FControllerNavigationWidgetRegistry::FWidgetClassInfo FControllerNavigationWidgetRegistry::GetClassInfo( const UClass* WidgetClass ) const
+{
+	if( const FWidgetClassInfo* CachedInfo = ClassCache.Find( FObjectKey( WidgetClass ) ) )
+	{
+		return *CachedInfo;
+	}
+
+	// The nearest registered class wins, so a subclass can be navigated differently to its parent.
+	FWidgetClassInfo Info;
+	for( const UClass* Class = WidgetClass; Class != nullptr && Info.Handler == nullptr; Class = Class->GetSuperClass() )
+	{
+		if( const TSharedRef<FControllerNavigationWidgetHandler>* Handler = Handlers.Find( FObjectKey( Class ) ) )
+		{
+			Info.Handler = &Handler->Get();
+		}
+	}
+
+	// Panels and User Widgets hold everything else, so hiding or disabling them changes what is navigable too.
+	Info.bWatch = ( Info.Handler != nullptr ) || WidgetClass->IsChildOf( UPanelWidget::StaticClass() ) || WidgetClass->IsChildOf( UUserWidget::StaticClass() );
+
+	ClassCache.Add( FObjectKey( WidgetClass ), Info );
+	return Info;
+}
+
+const FControllerNavigationWidgetHandler* FControllerNavigationWidgetRegistry::FindHandler( const UWidget* Widget ) const
+{
+	return ( Widget != nullptr ) ? GetClassInfo( Widget->GetClass() ).Handler : nullptr;
+}
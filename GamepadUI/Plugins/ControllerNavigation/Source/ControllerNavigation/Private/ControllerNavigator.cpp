@@ -3,30 +3,160 @@
 #include "ControllerNavigator.h"
 
 #include "ControllerNavigation.h"
+#include "ControllerNavigationSubsystem.h"
+#include "ControllerNavigationInputProcessor.h"
+#include "ControllerNavigationWidgetHandler.h"
+#include "ControllerNavigationStats.h"
 #include "Config/ConNavConfig.h"
 
 #include "Widget.h"
 #include "WidgetTree.h"
 #include "UserWidget.h"
 
+#include "NamedSlotInterface.h"
+#include "PanelWidget.h"
+#include "WidgetSwitcher.h"
+
 #include "SlateBlueprintLibrary.h"
 #include "SlateApplication.h"
 
 #include "Kismet/KismetMathLibrary.h"
 
-// Navigable Supported Widgets
-#include "Button.h"
+// Widgets we navigate specially.  Everything else navigable goes through FControllerNavigationWidgetRegistry.
+#include "ListView.h"
+#include "TileView.h"
 #include "ScrollBox.h"
-#include "Slider.h"
 //...?
 
 // Static Initialization
 UControllerNavigator* UControllerNavigator::ControllerNavigator = nullptr;
 
+namespace
+{
+	/** @return The current size of the Game Viewport, or zero if there isn't one. */
+	FIntPoint GetGameViewportSize()
+	{
+		if( GEngine != nullptr && GEngine->GameViewport != nullptr && GEngine->GameViewport->Viewport != nullptr )
+		{
+			return GEngine->GameViewport->Viewport->GetSizeXY();
+		}
+
+		return FIntPoint::ZeroValue;
+	}
+
+	/** The number of Slate ticks we wait for a pushed Widget to be laid out, before navigating it anyway (i.e. if it's Collapsed). */
+	const int32 MaxPendingNavigationFrames = 4;
+
+	/** Slide() values closer to 0 than this release the slide, so a resting stick doesn't creep. */
+	const float SlideDeadZone = .1f;
+
+	/** Slide()'s Multiplier used to be how far each call moved, and it was called every frame, so it is scaled by the 60fps frame time. */
+	const float SlideReferenceFrameTime = 1.f / 60.f;
+
+	/** @return True if the Widget has been laid out by Slate. */
+	bool HasLayout( const UWidget* Widget )
+	{
+		return Widget == nullptr || !Widget->GetCachedGeometry().GetLocalSize().IsNearlyZero();
+	}
+
+	/** Snapshot positions within this many pixels of the live geometry are considered up to date. */
+	const float GeometrySnapshotTolerance = .5f;
+
+	/** @return The configured Navigation Threshold. */
+	float GetNavigationThreshold()
+	{
+		float NavigationThreshold = 0.f;
+		UControllerNavigationConfig* config = GetMutableDefault<UControllerNavigationConfig>();
+		if( config != nullptr )
+		{
+			NavigationThreshold = config->GetNavigationThreshold();
+		}
+
+		return NavigationThreshold;
+	}
+}
+
+static FAutoConsoleCommand DumpNeighbourGraphCommand(
+	TEXT( "ControllerNavigation.DumpNeighbourGraph" ),
+	TEXT( "Logs the Up/Down/Left/Right neighbours of every navigable Widget on the top layer, alongside the Widget a Linear search would pick." ),
+	FConsoleCommandDelegate::CreateStatic( &UControllerNavigator::DumpNeighbourGraph ) );
+
+FNavigatorWatchedWidget::FNavigatorWatchedWidget( UWidget* InWidget )
+	: Widget( InWidget )
+	, Visibility( InWidget->Visibility )
+	, NumChildren( 0 )
+	, ActiveChildIndex( INDEX_NONE )
+	, bIsEnabled( InWidget->bIsEnabled )
+{
+	if( UPanelWidget* Panel = Cast<UPanelWidget>( InWidget ) )
+	{
+		NumChildren = Panel->GetChildrenCount();
+
+		// Switching pages changes which Widgets are on screen.
+		if( UWidgetSwitcher* Switcher = Cast<UWidgetSwitcher>( Panel ) )
+		{
+			ActiveChildIndex = Switcher->GetActiveWidgetIndex();
+		}
+	}
+	else if( UUserWidget* UserWidget = Cast<UUserWidget>( InWidget ) )
+	{
+		NumChildren = ( UserWidget->WidgetTree != nullptr && UserWidget->WidgetTree->RootWidget != nullptr ) ? 1 : 0;
+	}
+}
+
+bool FNavigatorWatchedWidget::IsUnchanged() const
+{
+	UWidget* CurWidget = Widget.Get();
+	if( CurWidget == nullptr )
+	{
+		return false;
+	}
+
+	if( CurWidget->Visibility != Visibility || CurWidget->bIsEnabled != bIsEnabled )
+	{
+		return false;
+	}
+
+	// Watch for Children being added or removed, or the active page being switched.
+	const FNavigatorWatchedWidget Current( CurWidget );
+	return Current.NumChildren == NumChildren && Current.ActiveChildIndex == ActiveChildIndex;
+}
+
 UControllerNavigator::UControllerNavigator()
 	: CurNavigatedWidget( nullptr )
 	, HideCursorRange( 2.f )
 	, bHideCursorDuringNavigation( true )
+	, ScrollTarget( nullptr )
+	, ScrollTargetSource( nullptr )
+	, bScrollTargetResolved( false )
+	, SlideRawValue( 0.f )
+	, SlideHoldTime( 0.f )
+	, SlideDirection( 0.f )
+	, LastSlideFrame( 0 )
+	, SlideMaxAcceleration( 4.f )
+	, SlideAccelerationTime( 1.f )
+	, bCursorlessNavigation( false )
+	, bTrackMouse( false )
+	, InputMode( ENavigationInputMode::NIM_Mouse )
+	, WarpScreenPosition( FVector2D::ZeroVector )
+	, MouseTravel( 0.f )
+	, MouseModeThreshold( 8.f )
+	, bOwnsCursor( true )
+	, SlateUserIndex( 0 )
+	, SearchMode( ENavigationSearchMode::NSM_Linear )
+	, Scoring( ENavigationScoring::NS_Legacy )
+	, bBackgroundGraphBuild( true )
+	, ParallelScoringThreshold( FNavigationScoring::DefaultParallelThreshold )
+	, PendingInitialFocus( nullptr )
+	, PendingFrames( 0 )
+	, bPendingLayout( false )
+	, bResolvingPendingNavigation( false )
+	, bCoalesceNavigation( false )
+	, LastWidgetsVisited( 0 )
+	, LastWidgetsAccepted( 0 )
+	, NavigationCacheHits( 0 )
+	, NavigationCacheRebuilds( 0 )
+	, NavigationAllocations( 0 )
 {
 	// The editor evaluates the first call to hide the Cursor, down in NavigatorMovedMouse.
 	// This additional and Editor only call, fixes that.
@@ -44,6 +174,13 @@ UControllerNavigator::UControllerNavigator()
 #endif
 }
 
+void UControllerNavigator::BeginDestroy()
+{
+	ClearPendingNavigation();
+
+	Super::BeginDestroy();
+}
+
 UControllerNavigator* UControllerNavigator::GetInstance()
 {
 	if( UControllerNavigator::ControllerNavigator == nullptr )
@@ -59,6 +196,47 @@ UControllerNavigator* UControllerNavigator::GetInstance()
 	return ControllerNavigator;
 }
 
+UControllerNavigator* UControllerNavigator::GetInstanceForPlayer( APlayerController* Player )
+{
+	return UControllerNavigator::GetInstanceForLocalPlayer( ( Player != nullptr ) ? Player->GetLocalPlayer() : nullptr );
+}
+
+UControllerNavigator* UControllerNavigator::GetInstanceForLocalPlayer( const ULocalPlayer* LocalPlayer )
+{
+	if( LocalPlayer != nullptr )
+	{
+		UControllerNavigationSubsystem* Subsystem = LocalPlayer->GetSubsystem<UControllerNavigationSubsystem>();
+		if( Subsystem != nullptr && Subsystem->GetNavigator() != nullptr )
+		{
+			return Subsystem->GetNavigator();
+		}
+	}
+
+	return UControllerNavigator::GetInstance();
+}
+
+UControllerNavigator* UControllerNavigator::GetInstanceForUserIndex( int32 UserIndex )
+{
+	if( GEngine != nullptr && GEngine->GameViewport != nullptr )
+	{
+		UGameInstance* GameInstance = GEngine->GameViewport->GetGameInstance();
+		if( GameInstance != nullptr )
+		{
+			for( ULocalPlayer* LocalPlayer : GameInstance->GetLocalPlayers() )
+			{
+				UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForLocalPlayer( LocalPlayer );
+				if( Navigator->SlateUserIndex == UserIndex )
+				{
+					return Navigator;
+				}
+			}
+		}
+	}
+
+	// Without any Local Players, the singleton is the first User's.
+	return ( UserIndex == 0 ) ? UControllerNavigator::GetInstance() : nullptr;
+}
+
 void UControllerNavigator::Cleanup()
 {
 	//FString MessageText = FString::Printf( TEXT( "Navigator Cleanup..." ) );
@@ -76,199 +254,193 @@ void UControllerNavigator::Cleanup()
 	}
 }
 
-bool UControllerNavigator::PushWidget( UUserWidget* Widget )
+bool UControllerNavigator::PushWidget( UUserWidget* Widget, UWidget* InitialFocus, APlayerController* Player )
 {
+	LLM_SCOPE_CONTROLLERNAVIGATION();
+
 	if( Widget != nullptr )
 	{
 		// Add will "push" (in all other C++ containers!) the Widget to the END of the Array.
-		UControllerNavigator::GetInstance()->Widgets.Add( Widget );// Push( Widget );
-		UControllerNavigator::GetInstance()->CurNavigatedWidget = nullptr;
+		// New Layers start dirty, so their navigable Widgets are generated on first use.
+		// Reuse a popped Layer if there is one, so opening and closing menus doesn't keep reallocating.
+		UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+		if( Navigator->SpareLayers.Num() > 0 )
+		{
+			Navigator->Layers.Add( Navigator->SpareLayers.Pop( false ) );
+		}
+		else
+		{
+			Navigator->Layers.AddDefaulted();
+		}
+		Navigator->ClearNavigatedWidget();
+		Navigator->Layers.Last().Widget = Widget;
+		Navigator->bScrollTargetResolved = false;
+
+		// Anything still waiting was meant for the Layer underneath.
+		Navigator->ClearPendingNavigation();
+		if( InitialFocus != nullptr )
+		{
+			Navigator->FocusWidget( InitialFocus );
+		}
 		return true;
 	}
 
 	return false;
 }
 
-bool UControllerNavigator::PopWidget()
+bool UControllerNavigator::PopWidget( APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	if( Navigator->Layers.Num() > 0 )
 	{
 		// Needing to guarantee we remove the LAST item from the Widgets.  It is not clear if Pop does this
 		// (again, like all other C++ containers!)
-		//UControllerNavigator::GetInstance()->Widgets.Pop();
-		UControllerNavigator::GetInstance()->Widgets.RemoveAt( UControllerNavigator::GetInstance()->Widgets.Num() - 1 );
-		UControllerNavigator::GetInstance()->CurNavigatedWidget = nullptr;
+		//Navigator->Layers.Pop();
+		Navigator->SpareLayers.Add( Navigator->Layers.Pop( false ) );
+		Navigator->SpareLayers.Last().Reset();
+		Navigator->bScrollTargetResolved = false;
+		Navigator->ClearPendingNavigation();
+		Navigator->ClearNavigatedWidget();
+
+		// Go back to where we were on the revealed Layer.  Its cache is kept, and if anything changed while it was
+		// covered, its Watched Widgets will catch it on the next move, so there's no need to regenerate it here.
+		// If the Mouse has the cursor, leave it where it is.
+		UWidget* LastNavigatedWidget = ( Navigator->Layers.Num() > 0 ) ? Navigator->Layers.Last().LastNavigatedWidget : nullptr;
+		if( LastNavigatedWidget != nullptr && LastNavigatedWidget->IsVisible() && LastNavigatedWidget->GetIsEnabled() &&
+			!( Navigator->bTrackMouse && Navigator->InputMode == ENavigationInputMode::NIM_Mouse ) )
+		{
+			Navigator->FocusWidget( LastNavigatedWidget );
+		}
 		return true;
 	}
 
 	return false;
 }
 
-bool UControllerNavigator::RemoveAllWidgets()
+bool UControllerNavigator::RemoveAllWidgets( APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	if( Navigator->Layers.Num() > 0 )
 	{
-		UControllerNavigator::GetInstance()->Widgets.Empty();
-		UControllerNavigator::GetInstance()->NavigableWidgets.Empty();
-		UControllerNavigator::GetInstance()->CurNavigatedWidget = nullptr;
+		while( Navigator->Layers.Num() > 0 )
+		{
+			Navigator->SpareLayers.Add( Navigator->Layers.Pop( false ) );
+			Navigator->SpareLayers.Last().Reset();
+		}
+		Navigator->ClearNavigatedWidget();
+		Navigator->bScrollTargetResolved = false;
+		Navigator->ClearPendingNavigation();
 		return true;
 	}
 
 	return false;
 }
 
-bool UControllerNavigator::Up( bool bLoop )
+bool UControllerNavigator::Up( bool bLoop, APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
-	{
-		if( UControllerNavigator::GetInstance()->GenerateNavigableWidgets() )
-		{
-			return UControllerNavigator::GetInstance()->Navigate( ENavDirection::ND_Up, bLoop );
-		}
-	}
-
-	return false;
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	return Navigator->NavigateInDirection( ENavDirection::ND_Up, bLoop, 1, Navigator->bCoalesceNavigation );
 }
 
-bool UControllerNavigator::Down( bool bLoop )
+bool UControllerNavigator::Down( bool bLoop, APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
-	{
-		if( UControllerNavigator::GetInstance()->GenerateNavigableWidgets() )
-		{
-			return UControllerNavigator::GetInstance()->Navigate( ENavDirection::ND_Down, bLoop );
-		}
-	}
-
-	return false;
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	return Navigator->NavigateInDirection( ENavDirection::ND_Down, bLoop, 1, Navigator->bCoalesceNavigation );
 }
 
-bool UControllerNavigator::Left( bool bLoop )
+bool UControllerNavigator::Left( bool bLoop, APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
-	{
-		if( UControllerNavigator::GetInstance()->GenerateNavigableWidgets() )
-		{
-			return UControllerNavigator::GetInstance()->Navigate( ENavDirection::ND_Left, bLoop );
-		}
-	}
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	return Navigator->NavigateInDirection( ENavDirection::ND_Left, bLoop, 1, Navigator->bCoalesceNavigation );
+}
 
-	return false;
+bool UControllerNavigator::Right( bool bLoop, APlayerController* Player )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	return Navigator->NavigateInDirection( ENavDirection::ND_Right, bLoop, 1, Navigator->bCoalesceNavigation );
 }
 
-bool UControllerNavigator::Right( bool bLoop )
+bool UControllerNavigator::NavigateSteps( ENavDirection Direction, int32 Steps, bool bLoop, APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->Widgets.Num() > 0 )
-	{
-		if( UControllerNavigator::GetInstance()->GenerateNavigableWidgets() )
-		{
-			return UControllerNavigator::GetInstance()->Navigate( ENavDirection::ND_Right, bLoop );
-		}
-	}
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	return Navigator->NavigateInDirection( Direction, bLoop, Steps, Navigator->bCoalesceNavigation );
+}
 
-	return false;
+void UControllerNavigator::Select( bool bForceClick, APlayerController* Player )
+{
+	UControllerNavigator::GetInstanceForPlayer( Player )->SelectNavigatedWidget( bForceClick );
 }
 
-void UControllerNavigator::Select( bool bForceClick )
+void UControllerNavigator::Scroll( float ScrollValue, float Multiplier, bool bSameInputForSliders, APlayerController* Player )
 {
-	if( UControllerNavigator::GetInstance()->CurNavigatedWidget == nullptr && !bForceClick )
-	{
-		return;
-	}
+	SCOPE_CYCLE_COUNTER( STAT_ConNav_Scroll );
 
-	if( FSlateApplication::Get().IsInitialized() )
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	if( Navigator->Layers.Num() == 0 )
 	{
-		FSlateApplication& SlateApp = FSlateApplication::Get();
-		TSet<FKey> PressedKeys;
-
-		FPointerEvent MouseEvent(
-			0,
-			SlateApp.GetCursorPos(),
-			SlateApp.GetLastCursorPos(),
-			PressedKeys,
-			EKeys::LeftMouseButton,
-			0,
-			SlateApp.GetPlatformApplication()->GetModifierKeys()
-		);
-
-		TSharedPtr<FGenericWindow> GenWindow;
-		SlateApp.ProcessMouseButtonDownEvent( GenWindow, MouseEvent );
-		SlateApp.ProcessMouseButtonUpEvent( MouseEvent );
+		return;
 	}
-}
 
-void UControllerNavigator::Scroll( float ScrollValue, float Multiplier, bool bSameInputForSliders )
-{
-	if( UControllerNavigator::GetInstance()->NavigableWidgets.Num() == 0 )
+	const TArray<UWidget*>& NavigableWidgets = Navigator->Layers.Last().NavigableWidgets;
+	if( NavigableWidgets.Num() == 0 )
 	{
 		return;
 	}
 
 	if( bSameInputForSliders == true )
 	{
-		// Check if we are currently on a Slider
-		if( UControllerNavigator::GetInstance()->CurNavigatedWidget != nullptr )
+		// Check if we are currently on a Slider (or anything else Slide() adjusts)
+		const FControllerNavigationWidgetHandler* Handler = FControllerNavigationWidgetRegistry::Get().FindHandler( Navigator->CurNavigatedWidget );
+		if( Handler != nullptr && Handler->IsAdjustable() )
 		{
-			if( UControllerNavigator::GetInstance()->CurNavigatedWidget->IsA( USlider::StaticClass() ) )
-			{
-				return;
-			}
+			return;
 		}
 	}
 
-	// Attempt to find a ScrollBox.
-	UScrollBox* ScrollBox = nullptr;
-	for( int32 i = 0; i < UControllerNavigator::GetInstance()->NavigableWidgets.Num(); ++i )
+	// Only look for the ScrollBox when the navigated Widget (or the Layer) has changed.
+	if( !Navigator->bScrollTargetResolved || Navigator->ScrollTargetSource != Navigator->CurNavigatedWidget )
 	{
-		if( UControllerNavigator::GetInstance()->NavigableWidgets[i] != nullptr )
-		{
-			if( UControllerNavigator::GetInstance()->NavigableWidgets[i]->IsA( UScrollBox::StaticClass() ) )
-			{
-				ScrollBox = Cast<UScrollBox>( UControllerNavigator::GetInstance()->NavigableWidgets[i] );
-				break;
-			}
-		}
+		Navigator->ScrollTarget = Navigator->ResolveScrollTarget();
+		Navigator->ScrollTargetSource = Navigator->CurNavigatedWidget;
+		Navigator->bScrollTargetResolved = true;
 	}
 
-	// Exit if we do not.
+	UScrollBox* ScrollBox = Navigator->ScrollTarget;
+
+	// Exit if there isn't one.
 	if( ScrollBox == nullptr )
 	{
 		return;
 	}
 
 	// Get the Offset, add our value to it, then set the offset.
-	ScrollBox->SetScrollOffset( ScrollBox->GetScrollOffset() + ( ScrollValue * Multiplier ) );
-}
+	// The ScrollBox only clamps its offset when it ticks, so clamp it here, to know if it really moves.
+	const float PreviousOffset = ScrollBox->GetScrollOffset();
+	const float NewOffset = FMath::Clamp( PreviousOffset + ( ScrollValue * Multiplier ), 0.f, FMath::Max( ScrollBox->GetScrollOffsetOfEnd(), 0.f ) );
 
-void UControllerNavigator::Slide( float SlideValue, float Multiplier )
-{
-	// Check if we are currently on a Slider
-	if( UControllerNavigator::GetInstance()->CurNavigatedWidget != nullptr )
+	// This is called every frame, so a resting stick, or a ScrollBox already at its end, mustn't throw the geometry
+	// (and its graph) away every frame.
+	if( NewOffset == PreviousOffset )
 	{
-		if( UControllerNavigator::GetInstance()->CurNavigatedWidget->IsA( USlider::StaticClass() ) )
-		{
-			USlider* Slider = Cast<USlider>( UControllerNavigator::GetInstance()->CurNavigatedWidget );
-			if( Slider != nullptr )
-			{
-				float SlideAdjustment = SlideValue * Multiplier;
-
-				// Number of "Steps" the Adjustment contains.
-				int32 steps = FMath::RoundToInt( SlideAdjustment / Slider->StepSize );
+		return;
+	}
 
-				// Bring the current Slider value in line with the "stepping"
-				int32 curSteps = FMath::RoundToInt( Slider->GetValue() / Slider->StepSize );
+	ScrollBox->SetScrollOffset( NewOffset );
 
-				float SliderValue = ( curSteps + steps ) * Slider->StepSize;
+	// Everything within the ScrollBox has moved.
+	Navigator->Layers.Last().bGeometryDirty = true;
+}
 
-				// Ternary's for threshold Max/Min.
-				SliderValue = ( SliderValue > 1.f ) ? 1.f : SliderValue;
-				SliderValue = ( SliderValue < 0.f ) ? 0.f : SliderValue;
+void UControllerNavigator::Slide( float SlideValue, float Multiplier, APlayerController* Player )
+{
+	UControllerNavigator::GetInstanceForPlayer( Player )->SlideNavigatedWidget( SlideValue, Multiplier / SlideReferenceFrameTime );
+}
 
-				Slider->SetValue( SliderValue );
-				Slider->OnValueChanged.Broadcast( SliderValue );
-			}
-		}
-	}
+void UControllerNavigator::SetSlideAcceleration( float MaxAcceleration, float RampTime, APlayerController* Player )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	Navigator->SlideMaxAcceleration = FMath::Max( MaxAcceleration, 1.f );
+	Navigator->SlideAccelerationTime = FMath::Max( RampTime, 0.f );
 }
 
 bool UControllerNavigator::NavigatorMovedMouse( float MouseX, float MouseY, UObject* WorldContextObject )
@@ -305,7 +477,8 @@ bool UControllerNavigator::NavigatorMovedMouse( float MouseX, float MouseY, UObj
 		return true;
 	}
 
-	UControllerNavigator::GetInstance()->CurNavigatedWidget = nullptr;
+	// The Mouse has taken over, so drop anything we hovered without it.
+	UControllerNavigator::GetInstance()->ClearNavigatedWidget();
 	
 	if( UControllerNavigator::GetInstance()->bHideCursorDuringNavigation )
 	{
@@ -315,693 +488,817 @@ bool UControllerNavigator::NavigatorMovedMouse( float MouseX, float MouseY, UObj
 	return false;
 }
 
+bool UControllerNavigator::NavigateToIndex( UListView* ListView, int32 Index, APlayerController* Player )
+{
+	if( ListView == nullptr || Index < 0 || Index >= ListView->GetNumItems() )
+	{
+		return false;
+	}
+
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	// Navigate to the List even if we are already on it, so the cursor follows the selection.
+	Navigator->SelectListViewIndex( ListView, Index );
+	Navigator->NavigateToWidget( ListView );
+
+	return true;
+}
+
+void UControllerNavigator::SetMouseTracking( bool bTrack, float Threshold )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstance();
+	Navigator->bTrackMouse = bTrack;
+	Navigator->MouseModeThreshold = FMath::Max( Threshold, 0.f );
+	Navigator->MouseTravel = 0.f;
+}
+
+ENavigationInputMode UControllerNavigator::GetInputMode()
+{
+	return UControllerNavigator::GetInstance()->InputMode;
+}
+
 void UControllerNavigator::SetNavigationHidesCursor( bool bHide )
 {
 	UControllerNavigator::GetInstance()->bHideCursorDuringNavigation = bHide;
 }
 
-bool UControllerNavigator::GenerateNavigableWidgets()
+void UControllerNavigator::SetCursorlessNavigation( bool bCursorless, APlayerController* Player )
 {
-	UUserWidget* LastWidget = Widgets.Last();
-	// IMPORTANT: Passed widget must have bIsFocusable = true (ticked, in editor)
-	LastWidget->SetKeyboardFocus();
-	TArray<UWidget*> AllWidgets;
-	LastWidget->WidgetTree->GetAllWidgets( AllWidgets );
-	NavigableWidgets.Empty();
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
 
-	if( AllWidgets.Num() > 0 )
+	// Only the first Local Player has a cursor to move.
+	bCursorless = bCursorless || !Navigator->bOwnsCursor;
+	if( Navigator->bCursorlessNavigation != bCursorless )
 	{
-		for( int32 i = 0; i < AllWidgets.Num(); ++i )
-		{
-			// Check if our current Widget is a custom Widget, which we may have elements we
-			// want to navigate to.
-			TArray<UWidget*> ChildWidgets;
-			UUserWidget* ChildWidget = Cast<UUserWidget>( AllWidgets[i] );
-			if( ChildWidget != nullptr )
-			{
-				//FString curChildWidgetName = FString::Printf( TEXT( "Cast Child: %s" ), *ChildWidget->GetName() );
-				//GEngine->AddOnScreenDebugMessage( -1, 3.f, FColor::Red, *curChildWidgetName );
-
-				// If it *IS* a custom widget, check if it has any children and if so, loop through
-				// them, checking for supported widgets.
-				//
-				// TODO: Perform this loop for any number of depths.
-				ChildWidget->WidgetTree->GetAllWidgets( ChildWidgets );
-				for( int32 j = 0; j < ChildWidgets.Num(); ++j )
-				{
-					//FString curChildWidgetName = ChildWidgets[j]->GetName();
-					//GEngine->AddOnScreenDebugMessage( -1, 3.f, FColor::Green, *curChildWidgetName );
-					PopulateSupportedWidgetsArray( ChildWidgets[j] );
-				}
-			}
+		// Hand the current Widget's hover over to (or back from) the cursor.
+		Navigator->SetSlateHover( Navigator->HighlightedWidget.Get(), bCursorless );
+		Navigator->bCursorlessNavigation = bCursorless;
+	}
+}
 
-			//FString curWidgetName = AllWidgets[i]->GetName();
-			//GEngine->AddOnScreenDebugMessage( -1, 3.f, FColor::Blue, *curWidgetName );
-			PopulateSupportedWidgetsArray( AllWidgets[i] );
-		}
+void UControllerNavigator::SetNavigationCoalescing( bool bCoalesce, APlayerController* Player )
+{
+	UControllerNavigator::GetInstanceForPlayer( Player )->bCoalesceNavigation = bCoalesce;
+}
 
-		// Only ever return true if we have some Widgets to Navigate through.
-		if( NavigableWidgets.Num() > 0 )
-		{
-			return true;
-		}
+void UControllerNavigator::InvalidateNavigableWidgets( APlayerController* Player )
+{
+	for( FNavigatorLayer& Layer : UControllerNavigator::GetInstanceForPlayer( Player )->Layers )
+	{
+		Layer.bDirty = true;
 	}
-	else
+}
+
+void UControllerNavigator::SetNavigationSearchMode( ENavigationSearchMode Mode, APlayerController* Player )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	Navigator->SearchMode = Mode;
+
+	// The Neighbour Graph is only built with the geometry, and only when it is going to be used.
+	for( FNavigatorLayer& Layer : Navigator->Layers )
 	{
-		//FString MessageText = FString::Printf( TEXT( "Got NO Child Widgets!" ) );
-		//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
-		//UE_LOG( ControllerNavigationLog, Warning, TEXT( "%s" ), *MessageText );
+		Layer.bGeometryDirty = true;
 	}
+}
+void UControllerNavigator::SetBackgroundGraphBuild( bool bBackground, APlayerController* Player )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstanceForPlayer( Player );
+	Navigator->bBackgroundGraphBuild = bBackground;
 
-	return false;
+	// Don't leave a graph we've been told not to wait for still being built.
+	if( !bBackground )
+	{
+		for( FNavigatorLayer& Layer : Navigator->Layers )
+		{
+			Layer.Geometry.WaitForGraph();
+		}
+	}
 }
 
-void UControllerNavigator::PopulateSupportedWidgetsArray( UWidget* Widget )
+void UControllerNavigator::SetNavigationScoring( ENavigationScoring Mode, APlayerController* Player )
 {
-	//Widget->GetZOrder
-	//FString MessageText = FString::Printf( TEXT( "Button: %s, Y: %f." ), *button->GetLabelText().ToString(), absPos.Y );
-	//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
-	
-	// Early exit for Disabled or non-Visible Widgets, including checking all Parent
-	// widgets to check for their visibility.
-	if( !Widget->bIsEnabled || !Widget->IsVisible() || !IsAncestorVisible( Widget ) )
+	UControllerNavigator::GetInstanceForPlayer( Player )->Scoring = Mode;
+}
+
+void UControllerNavigator::SetParallelScoringThreshold( int32 NumWidgets, APlayerController* Player )
+{
+	UControllerNavigator::GetInstanceForPlayer( Player )->ParallelScoringThreshold = ( NumWidgets > 0 ) ? NumWidgets : FNavigationScoring::DefaultParallelThreshold;
+}
+
+void UControllerNavigator::GetNavigationCacheStats( int32& CacheHits, int32& CacheRebuilds )
+{
+	CacheHits = UControllerNavigator::GetInstance()->NavigationCacheHits;
+	CacheRebuilds = UControllerNavigator::GetInstance()->NavigationCacheRebuilds;
+}
+
+void UControllerNavigator::GetEnumerationStats( int32& WidgetsVisited, int32& WidgetsAccepted )
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstance();
+	WidgetsVisited = Navigator->LastWidgetsVisited;
+	WidgetsAccepted = Navigator->LastWidgetsAccepted;
+}
+
+int32 UControllerNavigator::GetNavigationAllocationCount()
+{
+	return UControllerNavigator::GetInstance()->NavigationAllocations;
+}
+
+void UControllerNavigator::SetNativeInputEnabled( bool bEnabled, bool bLoop )
+{
+	if( FControllerNavigationInputProcessor* InputProcessor = FControllerNavigationModule::GetInputProcessor() )
 	{
-		return;
+		InputProcessor->SetEnabled( bEnabled, bLoop );
 	}
+}
 
-	// If the Button does not support Keyboard focus (i.e. "Focusable" is unticked in the editor)
-	// then ignore this Button.
-	if( Widget->IsA( UButton::StaticClass() ) && !Widget->TakeWidget()->SupportsKeyboardFocus() )
+void UControllerNavigator::BindNavigationKey( FKey Key, ENavigationInputAction Action )
+{
+	if( FControllerNavigationInputProcessor* InputProcessor = FControllerNavigationModule::GetInputProcessor() )
 	{
-		return;
+		InputProcessor->BindKey( Key, Action );
 	}
+}
 
-	if( Widget->IsA( UButton::StaticClass() ) ||
-		Widget->IsA( UScrollBox::StaticClass() ) ||
-		Widget->IsA( USlider::StaticClass() ) )
+void UControllerNavigator::UnbindNavigationKey( FKey Key )
+{
+	if( FControllerNavigationInputProcessor* InputProcessor = FControllerNavigationModule::GetInputProcessor() )
 	{
-		//UButton* button = (UButton*)Widget;
-		//FVector2D absPos = button->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-		//FString MessageText = FString::Printf( TEXT( "Button: %s, Y: %f." ), *button->GetLabelText().ToString(), absPos.Y );
-		//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
-
-		NavigableWidgets.Push( Widget );
+		InputProcessor->UnbindKey( Key );
 	}
 }
 
-bool UControllerNavigator::IsAncestorVisible( UWidget* Widget )
+void UControllerNavigator::ResetNavigationKeys()
 {
-	bool bHasParent = true;
+	if( FControllerNavigationInputProcessor* InputProcessor = FControllerNavigationModule::GetInputProcessor() )
+	{
+		InputProcessor->ResetKeys();
+	}
+}
 
-	// First check for Widgets immediate parent.
-	UPanelWidget* parentWidget = Widget->GetParent();
-	if( parentWidget != nullptr )
+void UControllerNavigator::DumpNeighbourGraph()
+{
+	UControllerNavigator* Navigator = UControllerNavigator::GetInstance();
+	if( Navigator->Layers.Num() == 0 || !Navigator->GenerateNavigableWidgets() )
 	{
-		if( !parentWidget->IsVisible() )
-		{
-			return false;
-		}
+		UE_LOG( ControllerNavigationLog, Warning, TEXT( "DumpNeighbourGraph: There are no navigable Widgets." ) );
+		return;
 	}
-	else
+
+	FNavigatorLayer& Layer = Navigator->Layers.Last();
+	Layer.Geometry.WaitForGraph();
+	if( Layer.bGeometryDirty || Layer.Geometry.Num() != Layer.NavigableWidgets.Num() || !Layer.Geometry.HasGraph() )
 	{
-		bHasParent = false;
+		// Build the graph, even if we aren't currently navigating with it.
+		const ENavigationSearchMode PreviousMode = Navigator->SearchMode;
+		Navigator->SearchMode = ENavigationSearchMode::NSM_NeighbourGraph;
+		Navigator->CaptureGeometrySnapshot( Layer );
+		Navigator->SearchMode = PreviousMode;
+		Layer.Geometry.WaitForGraph();
 	}
 
-	while( bHasParent )
+	static const TCHAR* DirectionNames[FNavigationGraph::NumDirections] = { TEXT( "Up" ), TEXT( "Down" ), TEXT( "Left" ), TEXT( "Right" ) };
+	const auto GetWidgetName = []( const UWidget* Widget ) { return ( Widget != nullptr ) ? Widget->GetName() : FString( TEXT( "-" ) ); };
+
+	int32 NumDifferences = 0;
+	for( int32 i = 0; i < Layer.NavigableWidgets.Num(); ++i )
 	{
-		UPanelWidget* curParentWidget = parentWidget->GetParent();
-		if( curParentWidget != nullptr )
+		FString Line = FString::Printf( TEXT( "[%d] %s:" ), i, *GetWidgetName( Layer.NavigableWidgets[i] ) );
+		for( int32 Direction = 0; Direction < FNavigationGraph::NumDirections; ++Direction )
 		{
-			if( !curParentWidget->IsVisible() )
+			// Both sides ask the same question, with the same settings, as a move would.  Only the search differs.
+			FNavigationQuery GraphQuery = Navigator->MakeNavigationQuery( i, (ENavDirection)Direction, false );
+			FNavigationQuery LinearQuery = GraphQuery;
+			GraphQuery.Search = ENavigationLayoutSearch::NeighbourGraph;
+			LinearQuery.Search = ENavigationLayoutSearch::Linear;
+
+			const int32 GraphIndex = Layer.Geometry.FindTarget( GraphQuery );
+			UWidget* GraphWidget = ( GraphIndex != INDEX_NONE ) ? Layer.NavigableWidgets[GraphIndex] : nullptr;
+			const int32 LinearIndex = Layer.Geometry.FindTarget( LinearQuery );
+			UWidget* LinearWidget = ( LinearIndex != INDEX_NONE ) ? Layer.NavigableWidgets[LinearIndex] : nullptr;
+
+			Line += FString::Printf( TEXT( " %s=%s" ), DirectionNames[Direction], *GetWidgetName( GraphWidget ) );
+			if( GraphWidget != LinearWidget )
 			{
-				return false;
+				// Flag where a Linear search would have picked something else.
+				Line += FString::Printf( TEXT( " (Linear: %s)" ), *GetWidgetName( LinearWidget ) );
+				++NumDifferences;
 			}
 		}
-		else
-		{
-			bHasParent = false;
-			break;		// failsafe, in case bHasParent doesn't break our loop.
-		}
 
-		// Swap Pointers, so we can move to the next depth.
-		parentWidget = curParentWidget;
+		UE_LOG( ControllerNavigationLog, Log, TEXT( "%s" ), *Line );
 	}
 
-	return true;
+	UE_LOG( ControllerNavigationLog, Log, TEXT( "DumpNeighbourGraph: %d Widgets, %d moves differ from a Linear search." ), Layer.NavigableWidgets.Num(), NumDifferences );
 }
 
-bool UControllerNavigator::Navigate( ENavDirection Direction, bool bLoop )
+bool UControllerNavigator::GenerateNavigableWidgets()
 {
-	// Early exit if we have no Navigable Widgets.
-	if( NavigableWidgets.Num() == 0 )
+	SCOPE_CYCLE_COUNTER( STAT_ConNav_GenerateNavigableWidgets );
+	LLM_SCOPE_CONTROLLERNAVIGATION();
+
+	FNavigatorLayer& Layer = Layers.Last();
+	UUserWidget* LastWidget = Layer.Widget;
+	// IMPORTANT: Passed widget must have bIsFocusable = true (ticked, in editor)
+	LastWidget->SetKeyboardFocus();
+
+	if( IsLayerCacheValid( Layer ) )
 	{
-		return false;
+		++NavigationCacheHits;
+		return Layer.NavigableWidgets.Num() > 0;
 	}
 
-	// If we haven't navigated to a Widget on this Widget - do so.
-	if( CurNavigatedWidget == nullptr )
-	{		
-		// Get the First Widget
-		// We need to change this to the most top-left widget, not just the first index!
-		// TODO: Change to highlight a better Widget
-		// TODO: Update to support NOT highlighting unsupported Widgets and attempt to highlight the next one.
-		NavigateToWidget( NavigableWidgets[0] );
+	++NavigationCacheRebuilds;
 
-		return true;
-	}
+	// Everything is Reset rather than Emptied, so a rebuild only allocates if the menu has grown.
+	const SIZE_T AllocatedSizeBefore = Layer.GetAllocatedSize() + VisitedWidgets.GetAllocatedSize() + ScratchSlotNames.GetAllocatedSize();
+	Layer.NavigableWidgets.Reset();
+	Layer.WidgetIndices.Reset();
+	Layer.WatchedWidgets.Reset();
+	VisitedWidgets.Reset();
+	Layer.ViewportSize = GetGameViewportSize();
+	Layer.bDirty = false;
+	bScrollTargetResolved = false;
+	Layer.bGeometryDirty = true;
 
-	// Get the index of the currently highlighted Widget.
-	int32 highlightedIndex = -1;
-	for( int32 i = 0; i < NavigableWidgets.Num(); ++i )
+	if( LastWidget->WidgetTree != nullptr && LastWidget->WidgetTree->RootWidget != nullptr )
 	{
-		if( NavigableWidgets[i] == CurNavigatedWidget )
+		// One pass down from the root, skipping anything that isn't on screen.
+		GatherNavigableWidgets( LastWidget->WidgetTree->RootWidget );
+		LastWidgetsVisited = VisitedWidgets.Num();
+		INC_DWORD_STAT_BY( STAT_ConNav_WidgetsEnumerated, LastWidgetsVisited );
+		LastWidgetsAccepted = Layer.NavigableWidgets.Num();
+
+		if( Layer.GetAllocatedSize() + VisitedWidgets.GetAllocatedSize() + ScratchSlotNames.GetAllocatedSize() > AllocatedSizeBefore )
 		{
-			highlightedIndex = i;
-			break;
+			++NavigationAllocations;
 		}
-	}
 
-	if( highlightedIndex == -1 )
-	{
+		// Only ever return true if we have some Widgets to Navigate through.
+		if( Layer.NavigableWidgets.Num() > 0 )
+		{
+			return true;
+		}
+	}
+	else
+	{
+		//FString MessageText = FString::Printf( TEXT( "Got NO Child Widgets!" ) );
+		//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
+		//UE_LOG( ControllerNavigationLog, Warning, TEXT( "%s" ), *MessageText );
+	}
+
+	return false;
+}
+
+bool UControllerNavigator::IsLayerCacheValid( const FNavigatorLayer& Layer ) const
+{
+	if( Layer.bDirty || Layer.ViewportSize != GetGameViewportSize() )
+	{
+		return false;
+	}
+
+	// Comparing the captured state is far cheaper than walking the Widget Tree(s) again.
+	for( const FNavigatorWatchedWidget& Watched : Layer.WatchedWidgets )
+	{
+		if( !Watched.IsUnchanged() )
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UControllerNavigator::GatherNavigableWidgets( UWidget* Widget )
+{
+	if( Widget == nullptr )
+	{
+		return;
+	}
+
+	// The same Widget can be reachable more than once, i.e. Named Slot content.
+	bool bAlreadyVisited = false;
+	VisitedWidgets.Add( Widget, &bAlreadyVisited );
+	if( bAlreadyVisited )
+	{
+		return;
+	}
+
+	// Nothing below a Hidden or Disabled Widget can be navigated to, so don't even look.
+	if( !PopulateSupportedWidgetsArray( Widget ) )
+	{
+		return;
+	}
+
+	if( UWidgetSwitcher* Switcher = Cast<UWidgetSwitcher>( Widget ) )
+	{
+		// Only the active page of a Switcher is on screen.
+		GatherNavigableWidgets( Switcher->GetActiveWidget() );
+	}
+	else if( UPanelWidget* Panel = Cast<UPanelWidget>( Widget ) )
+	{
+		for( int32 i = 0; i < Panel->GetChildrenCount(); ++i )
+		{
+			GatherNavigableWidgets( Panel->GetChildAt( i ) );
+		}
+	}
+
+	// Check if our current Widget is a custom Widget, which we may have elements we
+	// want to navigate to.  Its Named Slot content lives in its own Widget Tree, so is found there.
+	if( UUserWidget* ChildWidget = Cast<UUserWidget>( Widget ) )
+	{
+		if( ChildWidget->WidgetTree != nullptr )
+		{
+			GatherNavigableWidgets( ChildWidget->WidgetTree->RootWidget );
+		}
+	}
+	// Other Widgets can hold Named Slot content too (i.e. Expandable Areas).
+	else if( INamedSlotInterface* NamedSlotHost = Cast<INamedSlotInterface>( Widget ) )
+	{
+		// GetSlotNames() appends, so nested hosts share the one array as a stack.
+		const int32 FirstSlot = ScratchSlotNames.Num();
+		NamedSlotHost->GetSlotNames( ScratchSlotNames );
+		const int32 EndSlot = ScratchSlotNames.Num();
+		for( int32 i = FirstSlot; i < EndSlot; ++i )
+		{
+			GatherNavigableWidgets( NamedSlotHost->GetContentForSlot( ScratchSlotNames[i] ) );
+		}
+		ScratchSlotNames.SetNum( FirstSlot, false );
+	}
+}
+
+bool UControllerNavigator::PopulateSupportedWidgetsArray( UWidget* Widget )
+{
+	//Widget->GetZOrder
+	//FString MessageText = FString::Printf( TEXT( "Button: %s, Y: %f." ), *button->GetLabelText().ToString(), absPos.Y );
+	//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
+
+	FNavigatorLayer& Layer = Layers.Last();
+
+	// One lookup per Widget, however many kinds of Widget we support.
+	const FControllerNavigationWidgetRegistry::FWidgetClassInfo ClassInfo = FControllerNavigationWidgetRegistry::Get().GetClassInfo( Widget->GetClass() );
+
+	// Remember the state of anything that could change what is navigable, so the Layer's
+	// cache can be invalidated when it does.
+	if( ClassInfo.bWatch )
+	{
+		Layer.WatchedWidgets.Add( FNavigatorWatchedWidget( Widget ) );
+	}
+
+	// Early exit for Disabled or non-Visible Widgets.  All Parent widgets have already
+	// been checked, as we never walk in to Hidden or Disabled ones.
+	if( !Widget->bIsEnabled || !Widget->IsVisible() )
+	{
+		return false;
+	}
+
+	// The handler can turn a Widget down, i.e. a Button with "Focusable" unticked in the editor.
+	// Its children may still be navigable, though.
+	if( ClassInfo.Handler != nullptr && ClassInfo.Handler->IsNavigable( Widget ) )
+	{
+		//UButton* button = (UButton*)Widget;
+		//FVector2D absPos = button->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
+		//FString MessageText = FString::Printf( TEXT( "Button: %s, Y: %f." ), *button->GetLabelText().ToString(), absPos.Y );
+		//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
+
+		Layer.WidgetIndices.Add( Widget, Layer.NavigableWidgets.Push( Widget ) );
+	}
+
+	return true;
+}
+
+bool UControllerNavigator::Navigate( ENavDirection Direction, bool bLoop, int32 Steps )
+{
+	SCOPE_CYCLE_COUNTER( STAT_ConNav_Navigate );
+	LLM_SCOPE_CONTROLLERNAVIGATION();
+
+	FNavigatorLayer& Layer = Layers.Last();
+	TArray<UWidget*>& NavigableWidgets = Layer.NavigableWidgets;
+
+	// Early exit if we have no Navigable Widgets.
+	if( NavigableWidgets.Num() == 0 || Steps <= 0 )
+	{
+		return false;
+	}
+
+	// Get the index of the currently highlighted Widget.
+	const int32* FoundIndex = ( CurNavigatedWidget != nullptr ) ? Layer.WidgetIndices.Find( CurNavigatedWidget ) : nullptr;
+
+	// If we haven't navigated to a Widget on this Widget - do so.
+	if( FoundIndex == nullptr )
+	{
+		// Get the First Widget
+		// We need to change this to the most top-left widget, not just the first index!
+		// TODO: Change to highlight a better Widget
+		// TODO: Update to support NOT highlighting unsupported Widgets and attempt to highlight the next one.
 		NavigateToWidget( NavigableWidgets[0] );
 
 		return true;
 	}
 
-	// Get the Position of the current Widget
-	// Loop through all Widgets.
-	// IN the loop, do the switch.
-	// Within the switch
-	//	- check for the various condition(s)
-	//	- i.e. If Up, check if we have any positions higher
-	//	- Also check if we're looping and go to the lowest.
+	const int32 highlightedIndex = *FoundIndex;
+	bool bMoved = false;
+
+	// Within a List, move between its items until we reach its edge.
+	if( UListView* ListView = Cast<UListView>( CurNavigatedWidget ) )
+	{
+		const int32 ListSteps = NavigateListView( ListView, Direction, Steps );
+		Steps -= ListSteps;
+		bMoved = ( ListSteps > 0 );
+	}
+
+	// Walk the Layer's geometry a step at a time, but only highlight the Widget we end up on.
+	int32 targetIndex = highlightedIndex;
+	for( ; Steps > 0; --Steps )
+	{
+		UWidget* nextWidget = FindNavigationTarget( Layer, targetIndex, Direction, bLoop );
+		if( nextWidget == nullptr )
+		{
+			break;
+		}
 
-	FVector2D CurrentWidgetPos = NavigableWidgets[highlightedIndex]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-	FVector2D CurrentWidgetSize = NavigableWidgets[highlightedIndex]->GetCachedGeometry().GetLocalSize();
-	CurrentWidgetPos.X += CurrentWidgetSize.X * .5f;
-	CurrentWidgetPos.Y += CurrentWidgetSize.Y * .5f;
+		targetIndex = Layer.WidgetIndices.FindChecked( nextWidget );
 
-	UWidget* nextWidget = nullptr;
+		// A List has to be highlighted before we can move through its items, so it takes the rest of the steps.
+		if( nextWidget->IsA( UListView::StaticClass() ) )
+		{
+			--Steps;
+			break;
+		}
+	}
 
-	float NavigationThreshold = 0.f;
-	UControllerNavigationConfig* config = GetMutableDefault<UControllerNavigationConfig>();
-	if( config != nullptr )
+	if( targetIndex == highlightedIndex )
 	{
-		NavigationThreshold = config->GetNavigationThreshold();
+		return bMoved;
 	}
 
-	for( int32 j = 0; j < NavigableWidgets.Num(); ++j )
+	NavigateToWidget( NavigableWidgets[targetIndex] );
+
+	if( Steps > 0 )
 	{
-		// Skip if the current widget is the one we're actively highlighting
-		if( CurNavigatedWidget == NavigableWidgets[j] )
+		if( UListView* ListView = Cast<UListView>( NavigableWidgets[targetIndex] ) )
 		{
-			continue;
+			NavigateListView( ListView, Direction, Steps );
 		}
+	}
+
+	return true;
+}
 
-		// Skip any widgets we "Support" but in different ways, like ScrollBoxes.
-		// (Add more items to skip here, if needed).
-		if( NavigableWidgets[j]->IsA( UScrollBox::StaticClass() ) )
+bool UControllerNavigator::NavigateInDirection( ENavDirection Direction, bool bLoop, int32 Steps, bool bCoalesce )
+{
+	// Coalesced moves are all made together, after Slate's tick.
+	if( ShouldDeferNavigation() || ( bCoalesce && CanCoalesceNavigation() ) )
+	{
+		DeferNavigation( (ENavigationInputAction)Direction, bLoop, Steps );
+		return true;
+	}
+
+	if( Layers.Num() > 0 )
+	{
+		if( GenerateNavigableWidgets() )
 		{
-			continue;
+			return Navigate( Direction, bLoop, Steps );
 		}
+	}
+
+	return false;
+}
 
-#define NAVIGATOR_MECHANISM 1
+bool UControllerNavigator::CanCoalesceNavigation() const
+{
+	return !bResolvingPendingNavigation && !GeometryOverride.IsBound() && Layers.Num() > 0 && FSlateApplication::IsInitialized();
+}
 
-#if NAVIGATOR_MECHANISM == 1
+void UControllerNavigator::SelectNavigatedWidget( bool bForceClick )
+{
+	SCOPE_CYCLE_COUNTER( STAT_ConNav_Select );
 
-		FVector2D CurrentTargetWidgetPos;
+	// There may be an Initial Focus, or moves, still to come.
+	if( !bForceClick && ShouldDeferNavigation() )
+	{
+		DeferNavigation( ENavigationInputAction::NIA_Select, false, 1 );
+		return;
+	}
 
-		switch( Direction )
+	if( CurNavigatedWidget == nullptr && !bForceClick )
+	{
+		return;
+	}
+
+	// Only fall back to a click if we have to: it is hit-tested and routed by Slate, and lands wherever the cursor is.
+	if( bForceClick || !ActivateWidget( CurNavigatedWidget ) )
+	{
+		SendSyntheticClick();
+	}
+}
+
+bool UControllerNavigator::HandleNavigationInput( ENavigationInputAction Action, bool bLoop, bool bRepeat )
+{
+	// Nothing pushed, so the key isn't ours.
+	if( Layers.Num() == 0 )
+	{
+		return false;
+	}
+
+	switch( Action )
+	{
+		// Key repeats can arrive several to a frame, so always coalesce them.
+		case ENavigationInputAction::NIA_Up:		NavigateInDirection( ENavDirection::ND_Up, bLoop, 1, true );		break;
+		case ENavigationInputAction::NIA_Down:		NavigateInDirection( ENavDirection::ND_Down, bLoop, 1, true );		break;
+		case ENavigationInputAction::NIA_Left:		NavigateInDirection( ENavDirection::ND_Left, bLoop, 1, true );		break;
+		case ENavigationInputAction::NIA_Right:		NavigateInDirection( ENavDirection::ND_Right, bLoop, 1, true );		break;
+
+		case ENavigationInputAction::NIA_Select:
 		{
-			case ENavDirection::ND_Up:
+			// Holding the button down shouldn't keep clicking.
+			if( CurNavigatedWidget == nullptr && !ShouldDeferNavigation() )
 			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				// Separately delcare, so that the nextWidgetPos always exists, even if it has 0,0 coordinates.
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-				// First, check the next widget is above our currently highlighted widget.
-				if( loopWidgetPos.Y != 0 && loopWidgetPos.Y < CurrentWidgetPos.Y )
-				{
-					// Guarantees we go "up" if something is above us.
-					if( nextWidget == nullptr )
-					{
-						nextWidget = NavigableWidgets[j];
-					}
-					else
-					{
-						// We need the vertical distance between the currently highlighted item and currently known
-						// next widget (we're going to move to).
-						// And similarly, the vertical distance between the currently highlighted widget and the current
-						// loop widget.
-						float vertDistCurToNext = CurrentWidgetPos.Y - nextWidgetPos.Y;
-						float vertDistCurToLoop = CurrentWidgetPos.Y - loopWidgetPos.Y;
-
-						// Make sure we only move "Up" to the nearest item.
-						if( vertDistCurToLoop <= vertDistCurToNext && vertDistCurToLoop > 0 && vertDistCurToNext > 0 )
-						{
-							// When navigating UP, find the closest widget in the X axis that is above us.
-							float horizDistCurToNext = FMath::Abs( CurrentWidgetPos.X - nextWidgetPos.X );
-							float horizDistCurToLoop = FMath::Abs( CurrentWidgetPos.X - loopWidgetPos.X );
-
-							if( horizDistCurToLoop - NavigationThreshold < horizDistCurToNext || horizDistCurToLoop + NavigationThreshold < horizDistCurToNext )
-							{
-								nextWidget = NavigableWidgets[j];
-							}
-						}
-					}
-				}
-
-				break;
+				return false;
 			}
-			case ENavDirection::ND_Down:
+			if( !bRepeat )
 			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-				// First, check the next widget is below our currently highlighted widget.
-				if( loopWidgetPos.Y != 0 && loopWidgetPos.Y > CurrentWidgetPos.Y )
-				{
-					// Guarantees we go "down" if something is below us.
-					if( nextWidget == nullptr )
-					{
-						CurrentTargetWidgetPos = loopWidgetPos;
-						nextWidget = NavigableWidgets[j];
-					}
-					else
-					{
-						// Take the current Widget location minus the TARGET
-						//
-						// Take the current Widget location minus the LOOP
-						//
-						// Check their sizes
-						// Use only the nearest
-
-						FVector2D CurToTarget = CurrentWidgetPos - CurrentTargetWidgetPos;
-						FVector2D CurToLoop = CurrentWidgetPos - loopWidgetPos;
-
-						float distCurToTarget = CurToTarget.Size();
-						float distCurToLoop = CurToLoop.Size();
-
-						if( distCurToLoop < distCurToTarget && distCurToLoop > 0 && distCurToTarget > 0 )
-						{
-							CurrentTargetWidgetPos = loopWidgetPos;
-							nextWidget = NavigableWidgets[j];
-						}
-					}
-				}
-
-				break;
+				SelectNavigatedWidget( false );
 			}
-			case ENavDirection::ND_Left:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
+			break;
+		}
+	}
 
-				// First, check the next widget is Left of our currently highlighted widget.
-				if( loopWidgetPos.X != 0 && loopWidgetPos.X < CurrentWidgetPos.X )
-				{
-					// Guarantees we go "Left" if something is Left of us.
-					if( nextWidget == nullptr )
-					{
-						// But still must be within our threshold!
-						if( loopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
-						{
-							nextWidget = NavigableWidgets[j];
-						}
-					}
-					else
-					{
-						float horizDistCurToNext = CurrentWidgetPos.X - nextWidgetPos.X;
-						float horizDistCurToLoop = CurrentWidgetPos.X - loopWidgetPos.X;
-
-						// Make sure we only move "Left" to the nearest item.
-						if( horizDistCurToLoop <= horizDistCurToNext && horizDistCurToLoop > 0 && horizDistCurToNext > 0 )
-						{
-							if( loopWidgetPos.X != 0 && loopWidgetPos.X < CurrentWidgetPos.X )
-							{
-								//if( loopWidgetPos.Y < currentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > currentWidgetPos.Y - NavigationThreshold )
-								//{
-								//	nextWidget = NavigableWidgets[j];
-								//}
-
-								// When navigating LEFT, find the closest widget in the Y axis that is left of us.
-								float vertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - nextWidgetPos.Y );
-								float vertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - loopWidgetPos.Y );
-
-								if( vertDistCurToLoop - NavigationThreshold < vertDistCurToNext || vertDistCurToLoop + NavigationThreshold < vertDistCurToNext )
-								{
-									nextWidget = NavigableWidgets[j];
-								}
-							}
-						}
-					}
-				}
+	// Even at the edge of the menu, Slate shouldn't move its own focus out from under us.
+	return true;
+}
 
-				break;
-			}
-			case ENavDirection::ND_Right:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
+bool UControllerNavigator::ShouldDeferNavigation() const
+{
+	if( bResolvingPendingNavigation || GeometryOverride.IsBound() || Layers.Num() == 0 || !FSlateApplication::IsInitialized() )
+	{
+		return false;
+	}
 
-				// First, check the next widget is to the Right of our currently highlighted widget.
-				if( loopWidgetPos.X != 0 && loopWidgetPos.X > CurrentWidgetPos.X )
-				{
-					// Guarantees we go "Right" if something is Right of us.
-					if( nextWidget == nullptr )
-					{
-						// But still must be within our threshold!
-						if( loopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
-						{
-							nextWidget = NavigableWidgets[j];
-						}
-					}
-					else
-					{
-						float horizDistNextToCur = nextWidgetPos.X - CurrentWidgetPos.X;
-						float horizDistLoopToCur = loopWidgetPos.X - CurrentWidgetPos.X;
-
-						// Make sure we only move "Right" to the nearest item.
-						if( horizDistLoopToCur <= horizDistNextToCur && horizDistLoopToCur > 0 && horizDistNextToCur > 0 )
-						{
-							// First, check the next widget is to the right of our currently highlighted widget.
-							if( loopWidgetPos.X != 0 && loopWidgetPos.X > CurrentWidgetPos.X )
-							{
-								//if( loopWidgetPos.Y < currentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > currentWidgetPos.Y - NavigationThreshold )
-								//{
-								//	nextWidget = NavigableWidgets[j];
-								//}
-
-								// When navigating RIGHT, find the closest widget in the Y axis that is right of us.
-								float vertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - nextWidgetPos.Y );
-								float vertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - loopWidgetPos.Y );
-
-								if( vertDistCurToLoop - NavigationThreshold < vertDistCurToNext || vertDistCurToLoop + NavigationThreshold < vertDistCurToNext )
-								{
-									nextWidget = NavigableWidgets[j];
-								}
-							}
-						}
-					}
-				}
+	// Queue behind anything already waiting, so everything happens in the order it was asked for.
+	if( PendingInputs.Num() > 0 || PendingInitialFocus != nullptr )
+	{
+		return true;
+	}
 
-				break;
-			}
+	// Until then, every Widget on the Layer would be measured as sitting at 0,0.
+	return !HasLayout( Layers.Last().Widget );
+}
+
+void UControllerNavigator::DeferNavigation( ENavigationInputAction Action, bool bLoop, int32 Steps )
+{
+	// Repeated moves in the same direction become one move of several steps.
+	FNavigatorPendingInput* LastInput = ( PendingInputs.Num() > 0 ) ? &PendingInputs.Last() : nullptr;
+	if( LastInput != nullptr && LastInput->Action == Action && LastInput->bLoop == bLoop && Action != ENavigationInputAction::NIA_Select )
+	{
+		LastInput->Steps += Steps;
+	}
+	else
+	{
+		FNavigatorPendingInput& Input = PendingInputs.AddDefaulted_GetRef();
+		Input.Action = Action;
+		Input.bLoop = bLoop;
+		Input.Steps = Steps;
+	}
+
+	WaitForLayout();
+}
+
+void UControllerNavigator::WaitForLayout()
+{
+	if( Layers.Num() > 0 && !HasLayout( Layers.Last().Widget ) )
+	{
+		bPendingLayout = true;
+	}
+
+	if( !PostTickHandle.IsValid() && FSlateApplication::IsInitialized() )
+	{
+		PendingFrames = 0;
+		PostTickHandle = FSlateApplication::Get().OnPostTick().AddUObject( this, &UControllerNavigator::ResolvePendingNavigation );
+	}
+}
+
+void UControllerNavigator::ClearPendingNavigation()
+{
+	PendingInputs.Reset();
+	PendingInitialFocus = nullptr;
+	bPendingLayout = false;
+
+	if( PostTickHandle.IsValid() )
+	{
+		if( FSlateApplication::IsInitialized() )
+		{
+			FSlateApplication::Get().OnPostTick().Remove( PostTickHandle );
 		}
-#else
+		PostTickHandle.Reset();
+	}
+}
+
+void UControllerNavigator::ResolvePendingNavigation( float DeltaTime )
+{
+	// Slate lays out and paints everything before its Post Tick, so keep waiting only while the Layer has no size.
+	if( Layers.Num() > 0 && !HasLayout( Layers.Last().Widget ) && ++PendingFrames < MaxPendingNavigationFrames )
+	{
+		return;
+	}
+
+	// Take the requests, in case performing them pushes or pops a Layer.
+	UWidget* InitialFocus = PendingInitialFocus;
+	const bool bWaitedForLayout = bPendingLayout;
+	Swap( PendingInputs, ResolvingInputs );
+	ClearPendingNavigation();
+
+	if( Layers.Num() == 0 )
+	{
+		ResolvingInputs.Reset();
+		return;
+	}
+
+	// Anything measured before the layout is wrong.
+	if( bWaitedForLayout )
+	{
+		Layers.Last().bGeometryDirty = true;
+	}
+
+	bResolvingPendingNavigation = true;
+
+	if( InitialFocus != nullptr )
+	{
+		NavigateToWidget( InitialFocus );
+	}
+
+	for( const FNavigatorPendingInput& Input : ResolvingInputs )
+	{
+		if( Input.Action == ENavigationInputAction::NIA_Select )
+		{
+			SelectNavigatedWidget( false );
+		}
+		else
+		{
+			NavigateInDirection( (ENavDirection)Input.Action, Input.bLoop, Input.Steps );
+		}
+	}
+	ResolvingInputs.Reset();
+
+	bResolvingPendingNavigation = false;
+}
+
+UWidget* UControllerNavigator::FindNavigationTarget( FNavigatorLayer& Layer, int32 FromIndex, ENavDirection Direction, bool bLoop )
+{
+	// Pick up the Neighbour Graph, if it has finished building in the background since the last move.
+	Layer.Geometry.PublishGraph();
+
+	// Rather than re-reading every Widget's geometry on every move, check the Widget we are moving from, and the one
+	// we pick, still match the snapshot.  This catches scrolling and most animation, InvalidateNavigableWidgets() covers the rest.
+	if( !IsGeometrySnapshotCurrent( Layer, FromIndex ) )
+	{
+		CaptureGeometrySnapshot( Layer );
+	}
+
+	int32 TargetIndex = FindTargetIndex( Layer, FromIndex, Direction, bLoop );
+	if( TargetIndex != INDEX_NONE && !IsGeometrySnapshotCurrent( Layer, TargetIndex ) )
+	{
+		CaptureGeometrySnapshot( Layer );
+		TargetIndex = FindTargetIndex( Layer, FromIndex, Direction, bLoop );
+	}
+
+	return ( TargetIndex != INDEX_NONE ) ? Layer.NavigableWidgets[TargetIndex] : nullptr;
+}
 
+int32 UControllerNavigator::NavigateListView( UListView* ListView, ENavDirection Direction, int32 Steps )
+{
+	const int32 NumItems = ListView->GetNumItems();
+	int32 CurIndex = ListView->GetIndexForItem( ListView->GetSelectedItem() );
+	if( NumItems == 0 || CurIndex == INDEX_NONE )
+	{
+		return 0;
+	}
+
+	// Items are laid out in rows of NumColumns, left to right, then top to bottom.
+	const int32 NumColumns = GetListViewColumns( ListView );
+	const int32 LastRow = ( NumItems - 1 ) / NumColumns;
+
+	int32 StepsTaken = 0;
+	for( ; StepsTaken < Steps; ++StepsTaken )
+	{
+		const int32 Column = CurIndex % NumColumns;
+		const int32 Row = CurIndex / NumColumns;
+
+		int32 NewIndex = INDEX_NONE;
 		switch( Direction )
 		{
 			case ENavDirection::ND_Up:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				// Separately delcare, so that the nextWidgetPos always exists, even if it has 0,0 coordinates.
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-				// First, check the next widget is above our currently highlighted widget.
-				if( loopWidgetPos.Y != 0 && loopWidgetPos.Y < CurrentWidgetPos.Y )
-				{
-					// Guarantees we go "up" if something is above us.
-					if( nextWidget == nullptr )
-					{
-						nextWidget = NavigableWidgets[j];
-					}
-					else
-					{
-						// We need the vertical distance between the currently highlighted item and currently known
-						// next widget (we're going to move to).
-						// And similarly, the vertical distance between the currently highlighted widget and the current
-						// loop widget.
-						float vertDistCurToNext = CurrentWidgetPos.Y - nextWidgetPos.Y;
-						float vertDistCurToLoop = CurrentWidgetPos.Y - loopWidgetPos.Y;
-
-						// Make sure we only move "Up" to the nearest item.
-						if( vertDistCurToLoop <= vertDistCurToNext && vertDistCurToLoop > 0 && vertDistCurToNext > 0 )
-						{
-							// When navigating UP, find the closest widget in the X axis that is above us.
-							float horizDistCurToNext = FMath::Abs( CurrentWidgetPos.X - nextWidgetPos.X );
-							float horizDistCurToLoop = FMath::Abs( CurrentWidgetPos.X - loopWidgetPos.X );
-							
-							if( horizDistCurToLoop - NavigationThreshold < horizDistCurToNext || horizDistCurToLoop + NavigationThreshold < horizDistCurToNext )
-							{
-								nextWidget = NavigableWidgets[j];
-							}
-						}
-					}
-				}
-
+				NewIndex = ( Row > 0 ) ? CurIndex - NumColumns : INDEX_NONE;
 				break;
-			}
 			case ENavDirection::ND_Down:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-				// First, check the next widget is below our currently highlighted widget.
-				if( loopWidgetPos.Y != 0 && loopWidgetPos.Y > CurrentWidgetPos.Y )
-				{
-					// Guarantees we go "down" if something is below us.
-					if( nextWidget == nullptr )
-					{
-						nextWidget = NavigableWidgets[j];
-					}
-					else
-					{
-						// We need the vertical distance between the currently known next widget (we're going to move to)
-						// and the currently highlighted item.
-						// And similarly, the vertical distance between the current loop widget
-						// and the currently highlighted widget.
-						// (The opposite to "Up", in the code above).
-						float vertDistNextToCur = nextWidgetPos.Y - CurrentWidgetPos.Y;
-						float vertDistLoopToCur = loopWidgetPos.Y - CurrentWidgetPos.Y;
-
-						if( vertDistLoopToCur <= vertDistNextToCur && vertDistLoopToCur > 0 && vertDistNextToCur > 0 )
-						{
-							// When navigating DOWN, find the closest widget in the X axis that is below us.
-							float horizDistCurToNext = FMath::Abs( CurrentWidgetPos.X - nextWidgetPos.X );
-							float horizDistCurToLoop = FMath::Abs( CurrentWidgetPos.X - loopWidgetPos.X );
-
-							if( horizDistCurToLoop - NavigationThreshold < horizDistCurToNext || horizDistCurToLoop + NavigationThreshold < horizDistCurToNext )
-							{
-								nextWidget = NavigableWidgets[j];
-							}
-						}
-					}
-				}
-
+				// The last row may be short, so drop on to its last item.
+				NewIndex = ( Row < LastRow ) ? FMath::Min( CurIndex + NumColumns, NumItems - 1 ) : INDEX_NONE;
 				break;
-			}
 			case ENavDirection::ND_Left:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-
-				// First, check the next widget is Left of our currently highlighted widget.
-				if( loopWidgetPos.X != 0 && loopWidgetPos.X < CurrentWidgetPos.X )
-				{
-					// Guarantees we go "Left" if something is Left of us.
-					if( nextWidget == nullptr )
-					{
-						// But still must be within our threshold!
-						if( loopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
-						{
-							nextWidget = NavigableWidgets[j];
-						}
-					}
-					else
-					{
-						float horizDistCurToNext = CurrentWidgetPos.X - nextWidgetPos.X;
-						float horizDistCurToLoop = CurrentWidgetPos.X - loopWidgetPos.X;
-
-						// Make sure we only move "Left" to the nearest item.
-						if( horizDistCurToLoop <= horizDistCurToNext && horizDistCurToLoop > 0 && horizDistCurToNext > 0 )
-						{
-							if( loopWidgetPos.X != 0 && loopWidgetPos.X < CurrentWidgetPos.X )
-							{
-								//if( loopWidgetPos.Y < currentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > currentWidgetPos.Y - NavigationThreshold )
-								//{
-								//	nextWidget = NavigableWidgets[j];
-								//}
-
-								// When navigating LEFT, find the closest widget in the Y axis that is left of us.
-								float vertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - nextWidgetPos.Y );
-								float vertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - loopWidgetPos.Y );
-
-								if( vertDistCurToLoop - NavigationThreshold < vertDistCurToNext || vertDistCurToLoop + NavigationThreshold < vertDistCurToNext )
-								{
-									nextWidget = NavigableWidgets[j];
-								}
-							}
-						}
-					}
-				}
-
+				NewIndex = ( NumColumns > 1 && Column > 0 ) ? CurIndex - 1 : INDEX_NONE;
 				break;
-			}
 			case ENavDirection::ND_Right:
-			{
-				FVector2D loopWidgetPos = NavigableWidgets[j]->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-				FVector2D loopWidgetSize = NavigableWidgets[j]->GetCachedGeometry().GetLocalSize();
-				loopWidgetPos.X += loopWidgetSize.X * .5f;
-				loopWidgetPos.Y += loopWidgetSize.Y * .5f;
-
-				FVector2D nextWidgetPos;
-				FVector2D nextWidgetSize;
-				if( nextWidget != nullptr )
-				{
-					nextWidgetPos = nextWidget->GetCachedGeometry().LocalToAbsolute( FVector2D( 0, 0 ) );
-					nextWidgetSize = nextWidget->GetCachedGeometry().GetLocalSize();
-					nextWidgetPos.X += nextWidgetSize.X * .5f;
-					nextWidgetPos.Y += nextWidgetSize.Y * .5f;
-				}
-
-				// First, check the next widget is to the Right of our currently highlighted widget.
-				if( loopWidgetPos.X != 0 && loopWidgetPos.X > CurrentWidgetPos.X )
-				{
-					// Guarantees we go "Right" if something is Right of us.
-					if( nextWidget == nullptr )
-					{
-						// But still must be within our threshold!
-						if( loopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
-						{
-							nextWidget = NavigableWidgets[j];
-						}
-					}
-					else
-					{
-						float horizDistNextToCur = nextWidgetPos.X - CurrentWidgetPos.X;
-						float horizDistLoopToCur = loopWidgetPos.X - CurrentWidgetPos.X;
-
-						// Make sure we only move "Right" to the nearest item.
-						if( horizDistLoopToCur <= horizDistNextToCur && horizDistLoopToCur > 0 && horizDistNextToCur > 0 )
-						{
-							// First, check the next widget is to the right of our currently highlighted widget.
-							if( loopWidgetPos.X != 0 && loopWidgetPos.X > CurrentWidgetPos.X )
-							{
-								//if( loopWidgetPos.Y < currentWidgetPos.Y + NavigationThreshold && loopWidgetPos.Y > currentWidgetPos.Y - NavigationThreshold )
-								//{
-								//	nextWidget = NavigableWidgets[j];
-								//}
-
-								// When navigating RIGHT, find the closest widget in the Y axis that is right of us.
-								float vertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - nextWidgetPos.Y );
-								float vertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - loopWidgetPos.Y );
-
-								if( vertDistCurToLoop - NavigationThreshold < vertDistCurToNext || vertDistCurToLoop + NavigationThreshold < vertDistCurToNext )
-								{
-									nextWidget = NavigableWidgets[j];
-								}
-							}
-						}
-					}
-				}
-
+				NewIndex = ( NumColumns > 1 && Column < NumColumns - 1 && CurIndex < NumItems - 1 ) ? CurIndex + 1 : INDEX_NONE;
 				break;
-			}
 		}
 
-#endif
+		if( NewIndex == INDEX_NONE )
+		{
+			break;
+		}
+		CurIndex = NewIndex;
 	}
 
-	if( nextWidget == nullptr )
+	// Only the item we end up on is selected and scrolled to, and the cursor follows it.
+	if( StepsTaken > 0 )
 	{
-		return false;
+		SelectListViewIndex( ListView, CurIndex );
+		if( CurNavigatedWidget == ListView )
+		{
+			NavigateToWidget( ListView );
+		}
 	}
-	else
+	return StepsTaken;
+}
+
+void UControllerNavigator::SelectListViewIndex( UListView* ListView, int32 Index ) const
+{
+	ListView->SetSelectedIndex( Index );
+	ListView->NavigateToIndex( Index );
+}
+
+int32 UControllerNavigator::GetListViewColumns( UListView* ListView ) const
+{
+	UTileView* TileView = Cast<UTileView>( ListView );
+	if( TileView == nullptr || TileView->GetEntryWidth() <= 0.f )
 	{
-		NavigateToWidget( nextWidget );
-		return true;
+		return 1;
 	}
+
+	// Tile Views fill each row with as many entries as fit across them.
+	FVector2D Centre;
+	FVector2D HalfSize;
+	GetWidgetGeometry( TileView, Centre, HalfSize );
+
+	return FMath::Max( FMath::FloorToInt( ( HalfSize.X * 2.f ) / TileView->GetEntryWidth() ), 1 );
+}
+
+int32 UControllerNavigator::FindTargetIndex( const FNavigatorLayer& Layer, int32 FromIndex, ENavDirection Direction, bool bLoop ) const
+{
+	return Layer.Geometry.FindTarget( MakeNavigationQuery( FromIndex, Direction, bLoop ) );
+}
+
+FNavigationQuery UControllerNavigator::MakeNavigationQuery( int32 FromIndex, ENavDirection Direction, bool bLoop ) const
+{
+	FNavigationQuery Query;
+	Query.FromIndex = FromIndex;
+	Query.Direction = (int32)Direction;
+	Query.Search = (ENavigationLayoutSearch)SearchMode;
+	Query.NavigationThreshold = GetNavigationThreshold();
+	Query.Scoring = (ENavigationLayoutScoring)Scoring;
+	Query.ParallelThreshold = ParallelScoringThreshold;
+	Query.bLoop = bLoop;
+
+	return Query;
 }
 
 void UControllerNavigator::NavigateToWidget( UWidget* Widget )
 {
+	SCOPE_CYCLE_COUNTER( STAT_ConNav_NavigateToWidget );
+
+	// i.e. Lists are navigated by item, so make sure there is one to start from.
+	if( const FControllerNavigationWidgetHandler* Handler = FControllerNavigationWidgetRegistry::Get().FindHandler( Widget ) )
+	{
+		Handler->OnNavigatedTo( Widget );
+	}
+
 	//FString MessageText = FString::Printf( TEXT( "Navigating to Widget: %s." ), *Widget->GetName() );
 	//GEngine->AddOnScreenDebugMessage( -1, 10.f, FColor::Emerald, *MessageText );
 
+	// Widgets with overridden geometry aren't on screen, so there is nowhere to move the cursor to.
+	if( GeometryOverride.IsBound() )
+	{
+		FVector2D HalfSize;
+		GetWidgetGeometry( Widget, NavigatorCursorPosition, HalfSize );
+		HighlightedWidget = Widget;
+		SetNavigatedWidget( Widget );
+		return;
+	}
+
+	// i.e. a List's selected entry, rather than the List as a whole.
+	UWidget* Highlight = GetHighlightWidget( Widget );
+
+	// Hover the Widget itself, rather than moving the cursor over it and waiting for Slate to notice.
+	if( bCursorlessNavigation )
+	{
+		SetSlateHover( HighlightedWidget.Get(), false );
+		SetNavigatedWidget( Widget );
+		SetSlateHover( Highlight, true );
+		HighlightedWidget = Highlight;
+		return;
+	}
+
 	// This can be empty, invalid or out of date - but it's the only way we can get the Widget's Geometry.
 	// Also, if the widget is bIsVolatile, then this will never get generated!!!
-	FGeometry widgetGeom = Widget->GetCachedGeometry();
+	FGeometry widgetGeom = Highlight->GetCachedGeometry();
 	FGeometry viewportAdjustedGeom;
 
 	UGameViewportClient* ViewClient = GEngine->GameViewport;
@@ -1013,11 +1310,11 @@ void UControllerNavigator::NavigateToWidget( UWidget* Widget )
 			FVector2D pixelPos;
 			FVector2D viewportPos;
 			FVector2D LocalCoords;
-			LocalCoords.X = Widget->GetCachedGeometry().GetLocalSize().X * .5f;
-			LocalCoords.Y = Widget->GetCachedGeometry().GetLocalSize().Y * .5f;
+			LocalCoords.X = widgetGeom.GetLocalSize().X * .5f;
+			LocalCoords.Y = widgetGeom.GetLocalSize().Y * .5f;
 			
 			//USlateBlueprintLibrary::LocalToViewport( Widget, widgetGeom, FVector2D( 0.f, 0.f ), pixelPos, viewportPos );
-			USlateBlueprintLibrary::LocalToViewport( Widget, widgetGeom, LocalCoords, pixelPos, viewportPos );
+			USlateBlueprintLibrary::LocalToViewport( Highlight, widgetGeom, LocalCoords, pixelPos, viewportPos );
 
 			float CursorOffsetX = 0.f;
 			float CursorOffsetY = 0.f;
@@ -1033,40 +1330,388 @@ void UControllerNavigator::NavigateToWidget( UWidget* Widget )
 
 			if( NavigatorCursorPosition.X > 0 && NavigatorCursorPosition.Y > 0 )
 			{
-				UWidget* OldNavigatedWidget = CurNavigatedWidget;
-				CurNavigatedWidget = Widget;
 				Viewport->SetMouse( (int32)NavigatorCursorPosition.X, (int32)NavigatorCursorPosition.Y );
+				INC_DWORD_STAT( STAT_ConNav_CursorWarps );
 
-				// MJ: 23/03/2018
-				// This process allows us to handle "hover" when used via this Plugin, but not generic
-				// mouse movements.
-				// If this becomes an issue, due to inconsistencies in UX, then consider creating an
-				// extended SSlider and USlider that implement an actual Un/Hover event system.
-
-				// Unhover the previous Widget - if it was a Slider.
-				if( OldNavigatedWidget != nullptr )
+				// Slate will see this as a Mouse move, so remember where it was to, to ignore it.
+				if( FSlateApplication::IsInitialized() )
 				{
-					if( OldNavigatedWidget->IsA( USlider::StaticClass() ) )
-					{
-						if( OnSliderHover.IsBound() )
-						{
-							OnSliderHover.Broadcast( Cast<USlider>( OldNavigatedWidget ), false );
-						}
-					}
+					WarpScreenPosition = FSlateApplication::Get().GetCursorPos();
 				}
 
-				// If the new Widget is a Slider, "Hover" it
-				if( CurNavigatedWidget != nullptr )
-				{
-					if( CurNavigatedWidget->IsA( USlider::StaticClass() ) )
-					{
-						if( OnSliderHover.IsBound() )
-						{
-							OnSliderHover.Broadcast( Cast<USlider>( CurNavigatedWidget ), true );
-						}
-					}
-				}
+				HighlightedWidget = Highlight;
+				SetNavigatedWidget( Widget );
+			}
+		}
+	}
+}
+
+void UControllerNavigator::FocusWidget( UWidget* Widget )
+{
+	if( ShouldDeferNavigation() )
+	{
+		PendingInitialFocus = Widget;
+		WaitForLayout();
+	}
+	else
+	{
+		NavigateToWidget( Widget );
+	}
+}
+
+void UControllerNavigator::SetNavigatedWidget( UWidget* Widget )
+{
+	UWidget* OldNavigatedWidget = CurNavigatedWidget;
+	CurNavigatedWidget = Widget;
+
+	// Remembered, so popping back to this Layer can return to it.
+	if( Widget != nullptr && Layers.Num() > 0 )
+	{
+		Layers.Last().LastNavigatedWidget = Widget;
+	}
+
+	// Unhover the previous Widget, then "Hover" the new one (i.e. Sliders broadcast OnSliderHover).
+	const FControllerNavigationWidgetRegistry& Registry = FControllerNavigationWidgetRegistry::Get();
+	if( const FControllerNavigationWidgetHandler* OldHandler = Registry.FindHandler( OldNavigatedWidget ) )
+	{
+		OldHandler->OnHover( this, OldNavigatedWidget, false );
+	}
+
+	if( const FControllerNavigationWidgetHandler* NewHandler = Registry.FindHandler( CurNavigatedWidget ) )
+	{
+		NewHandler->OnHover( this, CurNavigatedWidget, true );
+	}
+
+	if( OldNavigatedWidget != CurNavigatedWidget && OnNavigationFocusChanged.IsBound() )
+	{
+		OnNavigationFocusChanged.Broadcast( OldNavigatedWidget, CurNavigatedWidget );
+	}
+
+	// Navigating takes the cursor from the Mouse.
+	if( CurNavigatedWidget != nullptr )
+	{
+		SetInputMode( ENavigationInputMode::NIM_Navigation );
+	}
+}
+
+void UControllerNavigator::ClearNavigatedWidget()
+{
+	if( bCursorlessNavigation )
+	{
+		SetSlateHover( HighlightedWidget.Get(), false );
+	}
+	HighlightedWidget.Reset();
+	SetNavigatedWidget( nullptr );
+}
+
+UWidget* UControllerNavigator::GetHighlightWidget( UWidget* Widget ) const
+{
+	const FControllerNavigationWidgetHandler* Handler = FControllerNavigationWidgetRegistry::Get().FindHandler( Widget );
+	return ( Handler != nullptr ) ? Handler->GetHighlightWidget( Widget ) : Widget;
+}
+
+void UControllerNavigator::HandleMouseMove( const FVector2D& ScreenPosition, const FVector2D& Delta )
+{
+	// Most Mouse moves stop here, so keep this cheap.
+	if( !bTrackMouse || InputMode == ENavigationInputMode::NIM_Mouse )
+	{
+		return;
+	}
+
+	// Our own cursor moves arrive as Mouse moves too.
+	if( FVector2D::DistSquared( ScreenPosition, WarpScreenPosition ) <= FMath::Square( HideCursorRange ) )
+	{
+		return;
+	}
+
+	// A knocked desk shouldn't take the cursor back, so the Mouse has to move a little way first.
+	MouseTravel += Delta.Size();
+	if( MouseTravel >= MouseModeThreshold )
+	{
+		SetInputMode( ENavigationInputMode::NIM_Mouse );
+	}
+}
+
+void UControllerNavigator::SetInputMode( ENavigationInputMode Mode )
+{
+	MouseTravel = 0.f;
+
+	if( !bTrackMouse || InputMode == Mode )
+	{
+		return;
+	}
+	InputMode = Mode;
+
+	// The Mouse has taken over, so drop anything we hovered without it.
+	if( Mode == ENavigationInputMode::NIM_Mouse )
+	{
+		ClearNavigatedWidget();
+	}
+
+	if( bHideCursorDuringNavigation && FSlateApplication::IsInitialized() )
+	{
+		TSharedPtr<GenericApplication> PlatformApplication = FSlateApplication::Get().GetPlatformApplication();
+		if( PlatformApplication.IsValid() && PlatformApplication->Cursor.IsValid() )
+		{
+			PlatformApplication->Cursor->Show( Mode == ENavigationInputMode::NIM_Mouse );
+		}
+	}
+
+	if( OnInputModeChanged.IsBound() )
+	{
+		OnInputModeChanged.Broadcast( Mode );
+	}
+}
+
+void UControllerNavigator::SetSlateHover( UWidget* Widget, bool bHovered ) const
+{
+	if( Widget == nullptr )
+	{
+		return;
+	}
+
+	TSharedPtr<SWidget> SlateWidget = Widget->GetCachedWidget();
+	if( !SlateWidget.IsValid() )
+	{
+		return;
+	}
+
+	// Calling the handlers directly skips Slate's hit-test, but the Widgets still run their own hover logic
+	// (i.e. Buttons change style, play their hover sound and broadcast OnHovered/OnUnhovered).
+	if( bHovered )
+	{
+		SlateWidget->OnMouseEnter( Widget->GetCachedGeometry(), FPointerEvent() );
+
+		if( SlateWidget->SupportsKeyboardFocus() && FSlateApplication::IsInitialized() )
+		{
+			FSlateApplication::Get().SetUserFocus( SlateUserIndex, SlateWidget, EFocusCause::Navigation );
+		}
+	}
+	else
+	{
+		SlateWidget->OnMouseLeave( FPointerEvent() );
+	}
+}
+
+bool UControllerNavigator::ActivateWidget( UWidget* Widget )
+{
+	if( Widget == nullptr || !Widget->GetIsEnabled() )
+	{
+		return false;
+	}
+
+	const FControllerNavigationWidgetHandler* Handler = FControllerNavigationWidgetRegistry::Get().FindHandler( Widget );
+	return ( Handler != nullptr ) && Handler->Activate( Widget, SlateUserIndex );
+}
+
+void UControllerNavigator::SendSyntheticClick()
+{
+	if( !FSlateApplication::IsInitialized() )
+	{
+		return;
+	}
+
+	FSlateApplication& SlateApp = FSlateApplication::Get();
+	TSet<FKey> PressedKeys;
+
+	FPointerEvent MouseEvent(
+		SlateUserIndex,
+		0,
+		SlateApp.GetCursorPos(),
+		SlateApp.GetLastCursorPos(),
+		PressedKeys,
+		EKeys::LeftMouseButton,
+		0,
+		SlateApp.GetPlatformApplication()->GetModifierKeys()
+	);
+
+	// The cursor isn't over the navigated Widget in Cursorless mode, so click the Widget itself.
+	if( bCursorlessNavigation )
+	{
+		UWidget* ClickedWidget = HighlightedWidget.IsValid() ? HighlightedWidget.Get() : CurNavigatedWidget;
+		TSharedPtr<SWidget> SlateWidget = ( ClickedWidget != nullptr ) ? ClickedWidget->GetCachedWidget() : nullptr;
+		if( SlateWidget.IsValid() )
+		{
+			const FGeometry& Geometry = ClickedWidget->GetCachedGeometry();
+			SlateWidget->OnMouseButtonDown( Geometry, MouseEvent );
+			SlateWidget->OnMouseButtonUp( Geometry, MouseEvent );
+			INC_DWORD_STAT_BY( STAT_ConNav_SyntheticMouseEvents, 2 );
+		}
+		return;
+	}
+
+	TSharedPtr<FGenericWindow> GenWindow;
+	SlateApp.ProcessMouseButtonDownEvent( GenWindow, MouseEvent );
+	SlateApp.ProcessMouseButtonUpEvent( MouseEvent );
+	INC_DWORD_STAT_BY( STAT_ConNav_SyntheticMouseEvents, 2 );
+}
+
+void UControllerNavigator::SlideNavigatedWidget( float Input, float Rate )
+{
+	// Check if we are currently on a Slider (or anything else that can be adjusted)
+	const FControllerNavigationWidgetHandler* Handler = FControllerNavigationWidgetRegistry::Get().FindHandler( CurNavigatedWidget );
+	FControllerNavigationAdjustableValue Adjustable;
+	if( Handler == nullptr || FMath::Abs( Input ) < SlideDeadZone || !Handler->GetAdjustableValue( CurNavigatedWidget, Adjustable ) )
+	{
+		SlideWidget.Reset();
+		return;
+	}
+
+	// Moving to another Widget, reversing, or letting go for a frame starts a new slide.
+	const float Direction = FMath::Sign( Input );
+	const bool bNewSlide = SlideWidget.Get() != CurNavigatedWidget || Direction != SlideDirection || GFrameCounter > LastSlideFrame + 1;
+	if( bNewSlide )
+	{
+		SlideWidget = CurNavigatedWidget;
+		SlideDirection = Direction;
+		SlideHoldTime = 0.f;
+
+		// A press always moves at least one step, however short the frame.
+		SlideRawValue = Adjustable.Value + Direction * Adjustable.StepSize;
+	}
+	else if( GFrameCounter != LastSlideFrame )
+	{
+		const float DeltaTime = (float)FApp::GetDeltaTime();
+		SlideHoldTime += DeltaTime;
+
+		// Ease in to full speed, so small adjustments stay precise.
+		const float Ramp = ( SlideAccelerationTime > 0.f ) ? FMath::Min( SlideHoldTime / SlideAccelerationTime, 1.f ) : 1.f;
+		const float Acceleration = FMath::Lerp( 1.f, SlideMaxAcceleration, Ramp * Ramp );
+
+		SlideRawValue += Input * Rate * Adjustable.Span * Acceleration * DeltaTime;
+	}
+	LastSlideFrame = GFrameCounter;
+
+	SlideRawValue = FMath::Clamp( SlideRawValue, Adjustable.MinValue, Adjustable.MaxValue );
+
+	// Steps count from the Min Value, or from 0 if there isn't one.
+	float NewValue = SlideRawValue;
+	if( Adjustable.StepSize > 0.f )
+	{
+		const float StepOrigin = ( Adjustable.MinValue > TNumericLimits<float>::Lowest() ) ? Adjustable.MinValue : 0.f;
+		NewValue = StepOrigin + FMath::RoundToFloat( ( SlideRawValue - StepOrigin ) / Adjustable.StepSize ) * Adjustable.StepSize;
+		NewValue = FMath::Clamp( NewValue, Adjustable.MinValue, Adjustable.MaxValue );
+	}
+
+	// Settings often re-apply on every change, so only tell anyone when the value lands on a new step.
+	if( !FMath::IsNearlyEqual( NewValue, Adjustable.Value, Adjustable.Span * KINDA_SMALL_NUMBER ) )
+	{
+		Handler->SetAdjustableValue( CurNavigatedWidget, NewValue );
+	}
+}
+
+UScrollBox* UControllerNavigator::ResolveScrollTarget() const
+{
+	// Walk up from the navigated Widget.  At the top of a User Widget's tree, carry on up from the User Widget itself.
+	UWidget* Widget = CurNavigatedWidget;
+	while( Widget != nullptr )
+	{
+		if( UScrollBox* ScrollBox = Cast<UScrollBox>( Widget ) )
+		{
+			return ScrollBox;
+		}
+
+		UWidget* Parent = Widget->GetParent();
+		if( Parent == nullptr )
+		{
+			UWidgetTree* WidgetTree = Cast<UWidgetTree>( Widget->GetOuter() );
+			Parent = ( WidgetTree != nullptr ) ? Cast<UUserWidget>( WidgetTree->GetOuter() ) : nullptr;
+		}
+		Widget = Parent;
+	}
+
+	// Otherwise, the largest ScrollBox is the most likely to be the one the player wants.
+	UScrollBox* LargestScrollBox = nullptr;
+	float LargestArea = -1.f;
+	for( UWidget* NavigableWidget : Layers.Last().NavigableWidgets )
+	{
+		if( UScrollBox* ScrollBox = Cast<UScrollBox>( NavigableWidget ) )
+		{
+			FVector2D Centre;
+			FVector2D HalfSize;
+			GetWidgetGeometry( ScrollBox, Centre, HalfSize );
+
+			const float Area = HalfSize.X * HalfSize.Y;
+			if( Area > LargestArea )
+			{
+				LargestScrollBox = ScrollBox;
+				LargestArea = Area;
 			}
 		}
 	}
+
+	return LargestScrollBox;
+}
+
+bool UControllerNavigator::IsGeometrySnapshotCurrent( const FNavigatorLayer& Layer, int32 Index ) const
+{
+	if( Layer.bGeometryDirty || Layer.Geometry.Num() != Layer.NavigableWidgets.Num() )
+	{
+		return false;
+	}
+
+	// A graph still being built in the background is for this snapshot, so capturing another would only start again.
+	if( SearchMode == ENavigationSearchMode::NSM_NeighbourGraph && !Layer.Geometry.HasGraph() && !Layer.Geometry.IsBuildingGraph() )
+	{
+		return false;
+	}
+
+	FVector2D Centre;
+	FVector2D HalfSize;
+	GetWidgetGeometry( Layer.NavigableWidgets[Index], Centre, HalfSize );
+
+	return Centre.Equals( Layer.Geometry.GetSnapshot().GetCentre( Index ), GeometrySnapshotTolerance );
+}
+
+void UControllerNavigator::CaptureGeometrySnapshot( FNavigatorLayer& Layer )
+{
+	const SIZE_T AllocatedSizeBefore = Layer.GetAllocatedSize();
+
+	const FControllerNavigationWidgetRegistry& Registry = FControllerNavigationWidgetRegistry::Get();
+	Layer.Geometry.Reset( Layer.NavigableWidgets.Num() );
+	for( UWidget* Widget : Layer.NavigableWidgets )
+	{
+		FVector2D Centre;
+		FVector2D HalfSize;
+		GetWidgetGeometry( Widget, Centre, HalfSize );
+
+		// ScrollBoxes are scrolled, not navigated to, and Widgets that haven't been laid out yet have nowhere to navigate to.
+		const FControllerNavigationWidgetHandler* Handler = Registry.FindHandler( Widget );
+		uint8 Flags = ( Handler != nullptr && Handler->IsTarget() ) ? FNavigationSnapshot::Flag_Target : 0;
+		if( !HalfSize.IsNearlyZero() )
+		{
+			Flags |= FNavigationSnapshot::Flag_HasGeometry;
+		}
+
+		Layer.Geometry.Add( Centre, HalfSize, Flags );
+	}
+
+	// The graph is worked out for every Widget up front, so only pay for it when we are using it.
+	// For large layouts that happens in the background, and we search Linearly until it is ready.
+	Layer.Geometry.Build( SearchMode == ENavigationSearchMode::NSM_NeighbourGraph, bBackgroundGraphBuild );
+
+	Layer.bGeometryDirty = false;
+
+	if( Layer.GetAllocatedSize() > AllocatedSizeBefore )
+	{
+		++NavigationAllocations;
+	}
+}
+
+void UControllerNavigator::GetWidgetGeometry( UWidget* Widget, FVector2D& OutCentre, FVector2D& OutHalfSize ) const
+{
+	if( GeometryOverride.IsBound() )
+	{
+		GeometryOverride.Execute( Widget, OutCentre, OutHalfSize );
+		return;
+	}
+
+	// Matches how Navigate() has always measured Widgets: the absolute top-left, plus half the local size.
+	const FGeometry& Geometry = Widget->GetCachedGeometry();
+	const FVector2D Size = Geometry.GetLocalSize();
+
+	OutCentre = Geometry.LocalToAbsolute( FVector2D( 0, 0 ) );
+	OutCentre.X += Size.X * .5f;
+	OutCentre.Y += Size.Y * .5f;
+	OutHalfSize = Size * .5f;
 }
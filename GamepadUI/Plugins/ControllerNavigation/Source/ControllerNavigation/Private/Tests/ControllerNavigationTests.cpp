@@ -0,0 +1,281 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ControllerNavigator.h"
+
+#include "WidgetTree.h"
+#include "UserWidget.h"
+
+#include "CanvasPanel.h"
+#include "Button.h"
+
+/**
+* A square grid of Buttons, pushed on to a Navigator of its own so whatever the game has pushed is left alone.
+* As in the benchmark, the grid is never laid out, so its geometry is supplied through GeometryOverride and the
+* tests run headless:
+*
+*	UE4Editor-Cmd <Project> -nullrhi -unattended -ExecCmds="Automation RunTests ControllerNavigation,Quit"
+*
+* On an evenly spaced grid every search mode and scoring should make the same, obvious, choice: the next Button over.
+*/
+class FControllerNavigationTestMenu
+{
+public:
+
+	/**
+	* @param InGridSize The number of rows, and columns, of Buttons.
+	*/
+	explicit FControllerNavigationTestMenu( int32 InGridSize );
+	~FControllerNavigationTestMenu();
+
+	/**
+	* Pushes the grid, highlighting its top left Button.
+	* @param Mode The search mode to navigate it with.
+	* @param Scoring The scoring the Linear search uses.
+	* @param ParallelThreshold Passed to SetParallelScoringThreshold(), 1 to always score in parallel.
+	*/
+	void									Push( ENavigationSearchMode Mode, ENavigationScoring Scoring, int32 ParallelThreshold );
+
+	/** Pops the grid. */
+	void									Pop();
+
+	/**
+	* Moves in the passed direction, through the same static functions games call.  Without bLoop, moving off the edge
+	* of the grid stays put.
+	* @return True if the Navigator landed on the Button it should have.
+	*/
+	bool									Move( ENavDirection Direction );
+
+	/** @return The Navigator's GetNavigationAllocationCount(). */
+	int32									GetAllocationCount() const { return Navigator->NavigationAllocations; }
+
+	/** @return The Button the Navigator should be on. */
+	FString									DescribeExpected() const { return FString::Printf( TEXT( "row %d, column %d" ), Row, Column ); }
+
+	/** @return The Button the Navigator is on. */
+	FString									DescribeNavigated() const;
+
+private:
+
+	/** The Button at the passed row and column. */
+	UButton*								GetButton( int32 InRow, int32 InColumn ) const { return Buttons[InRow * GridSize + InColumn]; }
+
+	/** The number of rows, and columns, of Buttons. */
+	int32									GridSize;
+
+	/** The pushed menu, a Canvas Panel of Buttons. */
+	UUserWidget*							Root;
+
+	/** The Buttons, row by row. */
+	TArray<UButton*>						Buttons;
+
+	/** The centre of each Button. */
+	TMap<UWidget*, FVector2D>				Centres;
+
+	/** The Navigator the grid is pushed on to, and the one it replaced while the test runs. */
+	UControllerNavigator*					Navigator;
+	UControllerNavigator*					PreviousNavigator;
+
+	/** Where the Navigator should be. */
+	int32									Row;
+	int32									Column;
+};
+
+namespace
+{
+	/** Width, height and spacing of a Button. */
+	const FVector2D ButtonSize( 120.f, 40.f );
+	const float ButtonSpacing = 10.f;
+
+	/** The number of rows, and columns, of Buttons.  46 * 46 is enough Buttons to split the scoring over two tasks. */
+	const int32 TestGridSize = 46;
+
+	/** The number of moves made per search mode. */
+	const int32 NumMoves = 400;
+
+	/** A search mode, and scoring, to navigate with. */
+	struct FSearchConfig
+	{
+		const TCHAR*						Name;
+		ENavigationSearchMode				Mode;
+		ENavigationScoring					Scoring;
+		int32								ParallelThreshold;
+	};
+
+	const FSearchConfig SearchConfigs[] =
+	{
+		{ TEXT( "Linear" ),						ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_Legacy,			0 },
+		{ TEXT( "NearestCentre" ),				ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_NearestCentre,	0 },
+		{ TEXT( "NearestCentre (parallel)" ),	ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_NearestCentre,	1 },
+		{ TEXT( "AxisAligned" ),				ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_AxisAligned,		0 },
+		{ TEXT( "AxisAligned (parallel)" ),		ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_AxisAligned,		1 },
+		{ TEXT( "ConeWeighted" ),				ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_ConeWeighted,	0 },
+		{ TEXT( "ConeWeighted (parallel)" ),	ENavigationSearchMode::NSM_Linear,			ENavigationScoring::NS_ConeWeighted,	1 },
+		{ TEXT( "SpatialIndex" ),				ENavigationSearchMode::NSM_SpatialIndex,	ENavigationScoring::NS_Legacy,			0 },
+		{ TEXT( "NeighbourGraph" ),				ENavigationSearchMode::NSM_NeighbourGraph,	ENavigationScoring::NS_Legacy,			0 }
+	};
+
+	/** @return The next move, the same sequence every run for the same seed. */
+	ENavDirection GetMove( FRandomStream& Random )
+	{
+		return (ENavDirection)Random.RandRange( 0, 3 );
+	}
+}
+
+FControllerNavigationTestMenu::FControllerNavigationTestMenu( int32 InGridSize )
+	: GridSize( InGridSize )
+	, Row( 0 )
+	, Column( 0 )
+{
+	Root = NewObject<UUserWidget>( GetTransientPackage(), NAME_None, RF_Transient );
+	Root->WidgetTree = NewObject<UWidgetTree>( Root, TEXT( "WidgetTree" ), RF_Transient );
+	Root->AddToRoot();
+
+	UCanvasPanel* Canvas = Root->WidgetTree->ConstructWidget<UCanvasPanel>();
+	Root->WidgetTree->RootWidget = Canvas;
+
+	Buttons.Reserve( GridSize * GridSize );
+	for( int32 i = 0; i < GridSize * GridSize; ++i )
+	{
+		UButton* Button = Root->WidgetTree->ConstructWidget<UButton>();
+		Canvas->AddChild( Button );
+		Buttons.Add( Button );
+
+		const FVector2D TopLeft( ( i % GridSize ) * ( ButtonSize.X + ButtonSpacing ), ( i / GridSize ) * ( ButtonSize.Y + ButtonSpacing ) );
+		Centres.Add( Button, TopLeft + ButtonSize * .5f );
+	}
+
+	PreviousNavigator = UControllerNavigator::ControllerNavigator;
+	Navigator = NewObject<UControllerNavigator>();
+	Navigator->AddToRoot();
+	UControllerNavigator::ControllerNavigator = Navigator;
+
+	const TMap<UWidget*, FVector2D>* CentresPtr = &Centres;
+	Navigator->GeometryOverride.BindLambda( [ CentresPtr ]( UWidget* Widget, FVector2D& OutCentre, FVector2D& OutHalfSize )
+	{
+		const FVector2D* Centre = CentresPtr->Find( Widget );
+		OutCentre = ( Centre != nullptr ) ? *Centre : FVector2D::ZeroVector;
+		OutHalfSize = ( Centre != nullptr ) ? ButtonSize * .5f : FVector2D::ZeroVector;
+	} );
+
+	// Search the Neighbour Graph itself, not the Linear search used while it builds in the background.
+	UControllerNavigator::SetBackgroundGraphBuild( false );
+}
+
+FControllerNavigationTestMenu::~FControllerNavigationTestMenu()
+{
+	UControllerNavigator::ControllerNavigator = PreviousNavigator;
+	Navigator->RemoveFromRoot();
+	Navigator->MarkPendingKill();
+
+	Root->RemoveFromRoot();
+	Root->MarkPendingKill();
+}
+
+void FControllerNavigationTestMenu::Push( ENavigationSearchMode Mode, ENavigationScoring Scoring, int32 ParallelThreshold )
+{
+	UControllerNavigator::SetNavigationSearchMode( Mode );
+	UControllerNavigator::SetNavigationScoring( Scoring );
+	UControllerNavigator::SetParallelScoringThreshold( ParallelThreshold );
+
+	Row = 0;
+	Column = 0;
+	UControllerNavigator::PushWidget( Root, GetButton( Row, Column ) );
+}
+
+void FControllerNavigationTestMenu::Pop()
+{
+	UControllerNavigator::PopWidget();
+}
+
+bool FControllerNavigationTestMenu::Move( ENavDirection Direction )
+{
+	switch( Direction )
+	{
+		case ENavDirection::ND_Up:		UControllerNavigator::Up( false );		Row = FMath::Max( Row - 1, 0 );					break;
+		case ENavDirection::ND_Down:	UControllerNavigator::Down( false );	Row = FMath::Min( Row + 1, GridSize - 1 );		break;
+		case ENavDirection::ND_Left:	UControllerNavigator::Left( false );	Column = FMath::Max( Column - 1, 0 );			break;
+		default:						UControllerNavigator::Right( false );	Column = FMath::Min( Column + 1, GridSize - 1 );	break;
+	}
+
+	return Navigator->CurNavigatedWidget == GetButton( Row, Column );
+}
+
+FString FControllerNavigationTestMenu::DescribeNavigated() const
+{
+	const int32 Index = Buttons.IndexOfByKey( Cast<UButton>( Navigator->CurNavigatedWidget ) );
+	return ( Index != INDEX_NONE ) ? FString::Printf( TEXT( "row %d, column %d" ), Index / GridSize, Index % GridSize ) : FString( TEXT( "nothing" ) );
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FControllerNavigationSearchModesAgreeTest, "ControllerNavigation.SearchModesAgree",
+								  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FControllerNavigationSearchModesAgreeTest::RunTest( const FString& Parameters )
+{
+	FControllerNavigationTestMenu Menu( TestGridSize );
+
+	for( const FSearchConfig& Config : SearchConfigs )
+	{
+		Menu.Push( Config.Mode, Config.Scoring, Config.ParallelThreshold );
+
+		// Every search mode makes the same moves, so they should all end up on the same Buttons.
+		FRandomStream Random( 1234 );
+		for( int32 i = 0; i < NumMoves; ++i )
+		{
+			if( !Menu.Move( GetMove( Random ) ) )
+			{
+				AddError( FString::Printf( TEXT( "%s: move %d landed on %s, expected %s." ), Config.Name, i, *Menu.DescribeNavigated(), *Menu.DescribeExpected() ) );
+				break;
+			}
+		}
+
+		Menu.Pop();
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FControllerNavigationNoAllocationsTest, "ControllerNavigation.NoAllocationsOnceWarm",
+								  EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter )
+
+bool FControllerNavigationNoAllocationsTest::RunTest( const FString& Parameters )
+{
+	// GetNavigationAllocationCount() only sees the Navigator's caches growing, see its doc comment.
+	const int32 NumPasses = 3;
+
+	FControllerNavigationTestMenu Menu( TestGridSize );
+
+	for( const FSearchConfig& Config : SearchConfigs )
+	{
+		// The first pass is allowed to grow the caches, and popping and pushing again must reuse them.
+		Menu.Push( Config.Mode, Config.Scoring, Config.ParallelThreshold );
+		FRandomStream WarmUpRandom( 1234 );
+		for( int32 i = 0; i < NumMoves; ++i )
+		{
+			Menu.Move( GetMove( WarmUpRandom ) );
+		}
+		Menu.Pop();
+
+		const int32 AllocationsBefore = Menu.GetAllocationCount();
+		for( int32 Pass = 0; Pass < NumPasses; ++Pass )
+		{
+			Menu.Push( Config.Mode, Config.Scoring, Config.ParallelThreshold );
+			FRandomStream Random( 1234 );
+			for( int32 i = 0; i < NumMoves; ++i )
+			{
+				Menu.Move( GetMove( Random ) );
+			}
+			Menu.Pop();
+		}
+
+		TestEqual( FString::Printf( TEXT( "%s: cache growths over %d repeated passes" ), Config.Name, NumPasses ), Menu.GetAllocationCount() - AllocationsBefore, 0 );
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -4,6 +4,8 @@
 
 #include "Engine.h"
 
+class FControllerNavigationInputProcessor;
+
 class FControllerNavigationModule : public FDefaultGameModuleImpl
 {
 public:
@@ -13,11 +15,20 @@ public:
 	virtual void ShutdownModule() override;
 	virtual bool SupportsDynamicReloading() override;
 
+	/** @return The native input path, which is created with the module, or nullptr if the module isn't loaded. */
+	static FControllerNavigationInputProcessor* GetInputProcessor();
+
 protected:
 
 	bool HandleSettingsSaved();
 	void RegisterSettings();
 	void UnregisterSettings();
+
+	void RegisterInputProcessor();
+	void UnregisterInputProcessor();
+
+	/** Navigates from Slate's input, before it reaches any Widget. */
+	TSharedPtr<FControllerNavigationInputProcessor> InputProcessor;
 };
 
 DECLARE_LOG_CATEGORY_EXTERN( ControllerNavigationLog, Log, All );
\ No newline at end of file
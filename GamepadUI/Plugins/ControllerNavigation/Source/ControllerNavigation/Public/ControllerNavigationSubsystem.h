@@ -0,0 +1,37 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "Subsystems/LocalPlayerSubsystem.h"
+
+#include "ControllerNavigationSubsystem.generated.h"
+
+// Forward Declarations
+class UControllerNavigator;
+
+/**
+* Gives every Local Player their own UControllerNavigator, so each split-screen Player only navigates (and pays for)
+* the Widgets they have pushed.  The first Local Player uses the UControllerNavigator singleton, so the Navigator
+* functions that aren't passed a Player keep working as they always have.
+* Use UControllerNavigator::GetInstanceForPlayer() to find a Player's Navigator.
+*/
+UCLASS()
+class CONTROLLERNAVIGATION_API UControllerNavigationSubsystem : public ULocalPlayerSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	// USubsystem
+	virtual void							Initialize( FSubsystemCollectionBase& Collection ) override;
+	virtual void							Deinitialize() override;
+
+	/** @return This Local Player's Navigator. */
+	UControllerNavigator*					GetNavigator() const { return Navigator; }
+
+protected:
+
+	/** This Local Player's Navigator. */
+	UPROPERTY()
+		UControllerNavigator*				Navigator;
+};
@@ -0,0 +1,167 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UControllerNavigator;
+class UWidget;
+
+/** The value of a Widget that can be adjusted, i.e. a Slider's. */
+struct FControllerNavigationAdjustableValue
+{
+	FControllerNavigationAdjustableValue()
+		: Value( 0.f )
+		, MinValue( 0.f )
+		, MaxValue( 1.f )
+		, StepSize( 0.f )
+		, Span( 1.f )
+	{}
+
+	/** The current value. */
+	float									Value;
+
+	/** The lowest and highest values it can be set to. */
+	float									MinValue;
+	float									MaxValue;
+
+	/** The value only ever changes in whole steps of this size, from MinValue.  0 if it is continuous. */
+	float									StepSize;
+
+	/** How far the value moves in a second of sliding at full speed, before acceleration.  Usually MaxValue - MinValue. */
+	float									Span;
+};
+
+/**
+* Describes how the Navigator treats one kind of Widget: whether it can be navigated to, what Select does to it,
+* what Slide() adjusts on it, and what happens when it is navigated on to or off of.
+* Register one with FControllerNavigationWidgetRegistry for each Widget class; it is used for subclasses too.
+*/
+class CONTROLLERNAVIGATION_API FControllerNavigationWidgetHandler
+{
+public:
+	virtual ~FControllerNavigationWidgetHandler() {}
+
+	/**
+	* @param Widget The Widget, which is already known to be Visible and Enabled.
+	* @return True if the Widget can currently be navigated to.
+	*/
+	virtual bool							IsNavigable( UWidget* Widget ) const { return true; }
+
+	/** @return True if Widgets of this kind are navigated to.  If false, they are only scrolled (i.e. ScrollBoxes). */
+	virtual bool							IsTarget() const { return true; }
+
+	/** @return True if Widgets of this kind take Slide(), so Scroll() should leave them alone when asked to. */
+	virtual bool							IsAdjustable() const { return false; }
+
+	/**
+	* @param Widget The Widget.
+	* @param OutValue The Widget's current value, range and step.
+	* @return True if the Widget can be adjusted.
+	*/
+	virtual bool							GetAdjustableValue( UWidget* Widget, FControllerNavigationAdjustableValue& OutValue ) const { return false; }
+
+	/**
+	* Sets the Widget's value and broadcasts its change, as Slide() does.  Only called when the value actually changes.
+	* @param Widget The Widget to adjust.
+	* @param Value The new value, already clamped and stepped.
+	*/
+	virtual void							SetAdjustableValue( UWidget* Widget, float Value ) const {}
+
+	/**
+	* Performs the Widget's action, as Select() does.
+	* @param Widget The Widget to activate.
+	* @param SlateUserIndex The Slate User doing the selecting.
+	* @return True if the Widget was activated, false to fall back to a synthetic click.
+	*/
+	virtual bool							Activate( UWidget* Widget, int32 SlateUserIndex ) const { return false; }
+
+	/**
+	* Called when the Navigator moves on to, or off of, the Widget.
+	* @param Navigator The Navigator that moved.
+	* @param Widget The Widget.
+	* @param bHovered True if it was moved on to, false if it was moved off of.
+	*/
+	virtual void							OnHover( UControllerNavigator* Navigator, UWidget* Widget, bool bHovered ) const {}
+
+	/**
+	* @param Widget The navigated Widget.
+	* @return The Widget the cursor is moved over (or, when Cursorless, hovered) for it, i.e. a List's selected entry.
+	*/
+	virtual UWidget*						GetHighlightWidget( UWidget* Widget ) const { return Widget; }
+
+	/**
+	* Called before the Navigator moves to the Widget, to get it ready to be navigated.
+	* @param Widget The Widget.
+	*/
+	virtual void							OnNavigatedTo( UWidget* Widget ) const {}
+};
+
+/**
+* Maps Widget classes to the handlers that navigate them.  Buttons, Check Boxes, Combo Boxes, List Views, ScrollBoxes,
+* Sliders, Spin Boxes and Editable Text Boxes are registered up front.
+*
+* Each class is looked up once, walking up its super classes to the nearest registered one, and the answer cached,
+* so scanning a menu is a single map lookup per Widget, however many kinds of Widget are registered.
+* Game thread only.
+*/
+class CONTROLLERNAVIGATION_API FControllerNavigationWidgetRegistry
+{
+public:
+
+	/** What the Navigator needs to know about a Widget class. */
+	struct FWidgetClassInfo
+	{
+		FWidgetClassInfo()
+			: Handler( nullptr )
+			, bWatch( false )
+		{}
+
+		/** The handler for the class, or null if it can't be navigated to. */
+		const FControllerNavigationWidgetHandler*	Handler;
+
+		/** If true, changes to the Widget's state could change what is navigable (i.e. it is a Panel, or has a handler). */
+		bool										bWatch;
+	};
+
+	/** @return The registry. */
+	static FControllerNavigationWidgetRegistry&	Get();
+
+	/**
+	* Navigates Widgets of the passed class, and its subclasses without handlers of their own, with the passed handler.
+	* Replaces any handler already registered for the class.  Menus already pushed keep their navigable Widgets until
+	* UControllerNavigator::InvalidateNavigableWidgets() is called.
+	*
+	* @param WidgetClass The Widget class.
+	* @param Handler The handler to use.
+	*/
+	void									Register( const UClass* WidgetClass, TSharedRef<FControllerNavigationWidgetHandler> Handler );
+
+	/**
+	* Stops navigating Widgets of the passed class (unless a super class of it has a handler).
+	* @param WidgetClass The Widget class.
+	*/
+	void									Unregister( const UClass* WidgetClass );
+
+	/**
+	* @param WidgetClass The Widget class.
+	* @return What the Navigator needs to know about it.
+	*/
+	FWidgetClassInfo						GetClassInfo( const UClass* WidgetClass ) const;
+
+	/**
+	* @param Widget The Widget.
+	* @return The handler for the Widget's class, or null if it can't be navigated to.
+	*/
+	const FControllerNavigationWidgetHandler*	FindHandler( const UWidget* Widget ) const;
+
+private:
+	FControllerNavigationWidgetRegistry();
+
+	/** The registered handlers. */
+	TMap<FObjectKey, TSharedRef<FControllerNavigationWidgetHandler>>	Handlers;
+
+	/** Every class looked up so far.  Keyed by FObjectKey, so an unloaded class can't be mistaken for a new one. */
+	mutable TMap<FObjectKey, FWidgetClassInfo>	ClassCache;
+};
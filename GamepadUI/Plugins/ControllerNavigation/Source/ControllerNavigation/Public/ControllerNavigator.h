@@ -3,16 +3,39 @@
 #pragma once
 
 #include "Object.h"
+#include "SlateWrapperTypes.h"
+#include "InputCoreTypes.h"
+
+#include "NavigationLayout.h"
 
 #include "ControllerNavigator.generated.h"
 
 // Forward Declarations
 class UUserWidget;
+class UWidget;
+class UScrollBox;
+class UListView;
+class APlayerController;
+class ULocalPlayer;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FSliderHoverChange, class USlider*, Slider, bool, bHovered );
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams( FNavigationFocusChange, UWidget*, OldWidget, UWidget*, NewWidget );
+
+// Enum of who has the cursor
+UENUM( BlueprintType )
+enum class ENavigationInputMode : uint8
+{
+	NIM_Mouse			UMETA( DisplayName = "Mouse" ),
+	NIM_Navigation		UMETA( DisplayName = "Keyboard/Gamepad Navigation" )
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam( FNavigationInputModeChange, ENavigationInputMode, InputMode );
+
+/** Supplies a Widget's centre and half size in place of its cached geometry, i.e. for Widgets that are never laid out. */
+DECLARE_DELEGATE_ThreeParams( FNavigatorGeometryOverride, UWidget* /*Widget*/, FVector2D& /*OutCentre*/, FVector2D& /*OutHalfSize*/ );
 
 // Enum of Navigation Directions
-UENUM()
+UENUM( BlueprintType )
 enum class ENavDirection : uint8
 {
 	ND_Up			UMETA( DisplayName = "Navigate Up" ),
@@ -21,14 +44,160 @@ enum class ENavDirection : uint8
 	ND_Right		UMETA( DisplayName = "Navigate Right" )
 };
 
+// Enum of what the native input path can do with a key (the directions are in the same order as ENavDirection)
+UENUM( BlueprintType )
+enum class ENavigationInputAction : uint8
+{
+	NIA_Up			UMETA( DisplayName = "Navigate Up" ),
+	NIA_Down		UMETA( DisplayName = "Navigate Down" ),
+	NIA_Left		UMETA( DisplayName = "Navigate Left" ),
+	NIA_Right		UMETA( DisplayName = "Navigate Right" ),
+	NIA_Select		UMETA( DisplayName = "Select" )
+};
+
+// Enum of the ways we can search for the next Widget to navigate to (in the same order as ENavigationLayoutSearch)
+UENUM( BlueprintType )
+enum class ENavigationSearchMode : uint8
+{
+	NSM_Linear			UMETA( DisplayName = "Linear Scan" ),
+	NSM_SpatialIndex	UMETA( DisplayName = "Spatial Index" ),
+	NSM_NeighbourGraph	UMETA( DisplayName = "Neighbour Graph" )
+};
+
+// Enum of the ways the Linear search can score candidates (in the same order as ENavigationLayoutScoring)
+UENUM( BlueprintType )
+enum class ENavigationScoring : uint8
+{
+	NS_Legacy			UMETA( DisplayName = "Legacy" ),
+	NS_NearestCentre	UMETA( DisplayName = "Nearest Centre" ),
+	NS_AxisAligned		UMETA( DisplayName = "Axis Aligned" ),
+	NS_ConeWeighted		UMETA( DisplayName = "Cone Weighted" )
+};
+
+/**
+* The state of a single Widget, as it was when a FNavigatorLayer was generated.
+* If any of these values change, the layer's NavigableWidgets are out of date.
+*/
+struct FNavigatorWatchedWidget
+{
+	FNavigatorWatchedWidget( UWidget* InWidget );
+
+	/** @return True if the Widget still matches the state captured when this entry was made. */
+	bool									IsUnchanged() const;
+
+	/** The Widget being watched.  Weak, so we never keep removed Widgets alive. */
+	TWeakObjectPtr<UWidget>					Widget;
+
+	/** The Visibility of the Widget when captured. */
+	ESlateVisibility						Visibility;
+
+	/** The number of Children the Widget had when captured (Panels and User Widgets only). */
+	int32									NumChildren;
+
+	/** The active Widget Index when captured (Widget Switchers only). */
+	int32									ActiveChildIndex;
+
+	/** Whether the Widget was enabled when captured. */
+	bool									bIsEnabled;
+};
+
+/** A navigation request that arrived before the top Layer had been laid out, to be performed once it has been. */
+struct FNavigatorPendingInput
+{
+	/** What to do. */
+	ENavigationInputAction					Action;
+
+	/** If true, directions loop to the opposite side. */
+	bool									bLoop;
+
+	/** How many times to move in the direction. */
+	int32									Steps;
+};
+
+/**
+* Each UUserWidget pushed to the Navigator gets its own layer.  The layer caches the Widgets
+* we can navigate through, so they are only regenerated when something has invalidated them.
+*/
+USTRUCT()
+struct FNavigatorLayer
+{
+	GENERATED_BODY()
+
+	FNavigatorLayer()
+		: Widget( nullptr )
+		, LastNavigatedWidget( nullptr )
+		, ViewportSize( FIntPoint::ZeroValue )
+		, bDirty( true )
+		, bGeometryDirty( true )
+	{}
+
+	/** Empties the layer so it can be reused for another Widget, keeping all of its memory. */
+	void									Reset()
+	{
+		Widget = nullptr;
+		LastNavigatedWidget = nullptr;
+		NavigableWidgets.Reset();
+		WidgetIndices.Reset();
+		WatchedWidgets.Reset();
+		ViewportSize = FIntPoint::ZeroValue;
+		bDirty = true;
+		Geometry.Reset();
+		bGeometryDirty = true;
+	}
+
+	/** @return The number of bytes allocated by the layer's caches. */
+	SIZE_T									GetAllocatedSize() const
+	{
+		return NavigableWidgets.GetAllocatedSize() + WidgetIndices.GetAllocatedSize() + WatchedWidgets.GetAllocatedSize() + Geometry.GetAllocatedSize();
+	}
+
+	/** The pushed Widget this layer navigates through. */
+	UPROPERTY()
+		UUserWidget*						Widget;
+
+	/** The last Widget navigated to on this layer, to go back to when the layers above it are popped. */
+	UPROPERTY()
+		UWidget*							LastNavigatedWidget;
+
+	/** The Array of Navigable Widgets.  I.e. The Widgets that we support navigating to/from. */
+	UPROPERTY()
+		TArray<UWidget*>					NavigableWidgets;
+
+	/** Maps each of the NavigableWidgets back to its index. */
+	TMap<UWidget*, int32>					WidgetIndices;
+
+	/** Every Panel, User Widget and supported Widget visited during the last generation. */
+	TArray<FNavigatorWatchedWidget>			WatchedWidgets;
+
+	/** The Viewport size when NavigableWidgets was generated.  A resize will invalidate the layer. */
+	FIntPoint								ViewportSize;
+
+	/** If true, NavigableWidgets must be regenerated before being used again. */
+	bool									bDirty;
+
+	/** The geometry of each of the NavigableWidgets (same indices), captured in one pass, and searched to pick where we navigate to. */
+	FNavigationLayout						Geometry;
+
+	/** If true, Geometry must be recaptured before being used again. */
+	bool									bGeometryDirty;
+};
+
 UCLASS()
 class CONTROLLERNAVIGATION_API UControllerNavigator : public UObject
 {
 	GENERATED_BODY()
 
+	friend class FControllerNavigationBenchmark;
+	friend class FControllerNavigationTestMenu;
+	friend class UControllerNavigationSubsystem;
+	friend class FControllerNavigationInputProcessor;
+
 public:
 	UControllerNavigator();
 
+	// UObject
+	virtual void							BeginDestroy() override;
+
 	/**
 	* Use this class as a Singleton and thus, returns the current instance.
 	* @return UControllerNavigator The singleton active instance.
@@ -36,6 +205,28 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
 		static UControllerNavigator*		GetInstance();
 
+	/**
+	* Each Local Player has their own Navigator, with their own pushed Widgets and navigated Widget, so split-screen
+	* players can all navigate their own menus at once.  The first Local Player's Navigator is the singleton.
+	* The navigation functions below take an optional Player, to pick whose Navigator they work on.
+	* @param Player The Player Controller of a Local Player.
+	* @return UControllerNavigator The Player's Navigator, or the singleton if Player is null or isn't local.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static UControllerNavigator*		GetInstanceForPlayer( APlayerController* Player );
+
+	/**
+	* @param LocalPlayer The Local Player.
+	* @return UControllerNavigator The Local Player's Navigator, or the singleton if LocalPlayer is null.
+	*/
+	static UControllerNavigator*			GetInstanceForLocalPlayer( const ULocalPlayer* LocalPlayer );
+
+	/**
+	* @param UserIndex The Slate User, i.e. from an input event.
+	* @return UControllerNavigator The Navigator of the Local Player who is that Slate User, or nullptr if there isn't one.
+	*/
+	static UControllerNavigator*			GetInstanceForUserIndex( int32 UserIndex );
+
 	/**
 	* Cleans up all content within the Singleton.
 	* Requests a delete of the current UControllerNavigator instance.
@@ -46,25 +237,33 @@ public:
 	/**
 	* Attempts to push the passed Widget to the Array of handled and navigable widgets.
 	* This doesn't do any kind of checking, if the Widget has already been aded, it will be added again!
+	* A freshly created Widget has no geometry until Slate has laid it out, so anything navigating it before then
+	* (including InitialFocus) waits until it has been, and happens in the order it was asked for.
 	* @param Widget The passed UWidget that we will process and attempt to navigate with Controller/Keyboard input.
+	* @param InitialFocus An optional Widget, within Widget, to navigate to as soon as Widget has been laid out.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True If supported and successfully added, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							PushWidget( UUserWidget* Widget );
+		static bool							PushWidget( UUserWidget* Widget, UWidget* InitialFocus = nullptr, APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to pop the last Widget off the Array.
+	* The Widget underneath is navigated back to wherever it was left, straight away.  Its navigable Widgets were kept
+	* while it was covered, and are only regenerated if they have changed, so popping is cheap however deep the stack.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True If supported and successfully added, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							PopWidget();
+		static bool							PopWidget( APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to clear the list of Pushed widgets.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True if cleared, otherwise false.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							RemoveAllWidgets();
+		static bool							RemoveAllWidgets( APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to Navigate Up.
@@ -73,10 +272,11 @@ public:
 	* Similarly, if you navigate left, and are at the left most item, then it will jump to the right most item.
 	* 
 	* @param bLoop If True, Navigation will loop.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True if successfully navigated, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							Up( bool bLoop );
+		static bool							Up( bool bLoop, APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to Navigate Down.
@@ -85,10 +285,11 @@ public:
 	* Similarly, if you navigate left, and are at the left most item, then it will jump to the right most item.
 	*
 	* @param bLoop If True, Navigation will loop.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True if successfully navigated, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							Down( bool bLoop );
+		static bool							Down( bool bLoop, APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to Navigate Left.
@@ -97,10 +298,11 @@ public:
 	* Similarly, if you navigate left, and are at the left most item, then it will jump to the right most item.
 	*
 	* @param bLoop If True, Navigation will loop.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True if successfully navigated, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							Left( bool bLoop );
+		static bool							Left( bool bLoop, APlayerController* Player = nullptr );
 
 	/**
 	* Attempts to Navigate Right.
@@ -109,36 +311,86 @@ public:
 	* Similarly, if you navigate left, and are at the left most item, then it will jump to the right most item.
 	*
 	* @param bLoop If True, Navigation will loop.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	* @return True if successfully navigated, otherwise False.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static bool							Right( bool bLoop );
+		static bool							Right( bool bLoop, APlayerController* Player = nullptr );
 
 	/**
-	* Attempts to select the currently highlighted Widget.
+	* Moves several steps in one direction, i.e. to page through a long menu, in a single pass: the navigable Widgets
+	* are only generated once, and only the Widget we end up on is highlighted.
+	*
+	* @param Direction The ENavDirection to navigate in.
+	* @param Steps How many Widgets (or List items) to move by.
+	* @param bLoop If True, Navigation will loop.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	* @return True if successfully navigated, otherwise False.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static bool							NavigateSteps( ENavDirection Direction, int32 Steps, bool bLoop = false, APlayerController* Player = nullptr );
+
+	/**
+	* Attempts to select the currently highlighted Widget.  Buttons are clicked, Check Boxes toggled and
+	* Combo Boxes opened directly.  Anything else is sent a Mouse Click.
 	* @param bForceClick If true, will force a Mouse Click, ignoring if we have any highlighted widget.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static void							Select( bool bForceClick = false );
+		static void							Select( bool bForceClick = false, APlayerController* Player = nullptr );
 
 	/**
+	* Scrolls the ScrollBox the current Widget is in, or the largest ScrollBox if it isn't in one.
+	* The ScrollBox is only looked for when the current Widget changes, so this is cheap enough to call every frame.
+	*
 	* Checks if the current Widget has a Scrollable (like a ScrollBox) and will then attempt to Scroll
 	* that item, in the supplied direction.  This is most useful if an Axis is setup, such as Right Thumbstick
 	* then pass values in the range -/+ 0...1.
 	* @param ScrollValue The value to attempt to scroll (should be between -1 & +1).
 	* @param Multiplier An optional value to allow for faster scrolling.  Defaults to 3x the input.
 	* @param bSameInputForSliders If true and currently over a slider, then this input will ignore Scroll boxes.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static void							Scroll( float ScrollValue, float Multiplier = 3.f, bool bSameInputForSliders = false );
+		static void							Scroll( float ScrollValue, float Multiplier = 3.f, bool bSameInputForSliders = false, APlayerController* Player = nullptr );
 
 	/**
-	* Checks if we are currently highlighting a Slider and if so, will attempt to adjust the slider.
-	* @param SliderValue The value to attempt to adjust the slider with.
-	* @param Multiplier An optional value to adjust for faster/slower sliding. Defaults to 0.1.
+	* Checks if we are currently highlighting a Slider (or Spin Box) and if so, will attempt to adjust it.
+	* Call it every frame with the Axis value: the slide is integrated over the frame's delta time, so is the same
+	* speed at any frame rate, and speeds up the longer it is held (see SetSlideAcceleration()).  A fresh press always
+	* moves at least one step, so it works from a button too.  The value stays within the Widget's Min and Max Value,
+	* and OnValueChanged is only broadcast when the value moves to a new step.
+	*
+	* @param SlideValue The Axis value, from -1 to 1.  Values close to 0 release the slide.
+	* @param Multiplier An optional value to adjust for faster/slower sliding.  A full Axis moves the value by this much of
+	* the Widget's range per frame at 60fps (and by the same amount per second at any other frame rate), before
+	* acceleration.  Defaults to 0.1.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
 	*/
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
-		static void							Slide( float SlideValue, float Multiplier = .1f );
+		static void							Slide( float SlideValue, float Multiplier = .1f, APlayerController* Player = nullptr );
+
+	/**
+	* Sets how Slide() speeds up while it is held.
+	* @param MaxAcceleration How many times faster than the starting speed it gets.  1 never speeds up.  Defaults to 4.
+	* @param RampTime How many seconds it takes to reach full speed.  Defaults to 1.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetSlideAcceleration( float MaxAcceleration = 4.f, float RampTime = 1.f, APlayerController* Player = nullptr );
+
+	/**
+	* List and Tile Views are navigated by item, rather than by the Widgets they have generated, so only the visible
+	* entries ever need to exist.  Use this to move to a particular item, i.e. to restore the player's last choice.
+	* The item is selected, scrolled in to view and the List becomes the navigated Widget.
+	*
+	* @param ListView The List (or Tile) View to navigate within.
+	* @param Index The index of the item to navigate to.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	* @return True if the item exists, otherwise false.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static bool							NavigateToIndex( UListView* ListView, int32 Index, APlayerController* Player = nullptr );
 
 	/**
 	* In order to trigger the over/out events build in to UMG, we move the mouse cursor.  But if you're controlling
@@ -146,6 +398,7 @@ public:
 	* showing or not, so when we move the cursor, you can check for the Event and if the values match those of where
 	* we moved the cursor, you can ignore the movements.
 	* Any other movements, the player has "wiggled" the mouse, so you can show the cursor again.
+	* There is no need to call this if you have turned on SetMouseTracking(), which does the same natively.
 	*
 	* @param MouseX The X coordinate from the Mouse event.
 	* @param MouseY The Y coordinate from the Mouse event.
@@ -155,6 +408,24 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation", meta = ( WorldContext = WorldContextObject ) )
 		static bool							NavigatorMovedMouse( float MouseX, float MouseY, UObject* WorldContextObject );
 
+	/**
+	* Tracks whether the Mouse or the Navigator has the cursor natively, instead of you calling NavigatorMovedMouse()
+	* on every Mouse move.  The cursor is handed to the Navigator as soon as it navigates, and back to the Mouse once it
+	* has moved Threshold pixels by itself (the Navigator's own cursor moves are ignored), showing/hiding the cursor
+	* and broadcasting OnInputModeChanged each time.  Only the first Local Player has a cursor.  Off by default.
+	*
+	* @param bTrack True to track the cursor.
+	* @param Threshold How far, in pixels, the Mouse has to move to take the cursor back.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static void							SetMouseTracking( bool bTrack, float Threshold = 8.f );
+
+	/**
+	* @return Who currently has the cursor.  Only updated while Mouse Tracking is on.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static ENavigationInputMode			GetInputMode();
+
 	/**
 	* When navigating with this Plugin, by default the Mouse Cursor is hidden.  Use this function to adjust whether
 	* this is still the case.
@@ -164,10 +435,176 @@ public:
 	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
 		static void							SetNavigationHidesCursor( bool bHide );
 
+	/**
+	* By default, navigating moves the Mouse Cursor over the target Widget and Slate hovers it on the next frame.
+	* In Cursorless mode the cursor is left alone: the target is hovered and focused directly, which saves a frame of
+	* latency and a hit-test of the whole Viewport per move.  Bind OnNavigationFocusChanged to draw your own highlight.
+	*
+	* Only the first Local Player has a cursor, so every other Player's Navigator is always Cursorless.
+	*
+	* @param bCursorless True to navigate without moving the cursor, false to move the cursor.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetCursorlessNavigation( bool bCursorless, APlayerController* Player = nullptr );
+
+	/**
+	* When a stick or key is auto-repeating, or being called from a fast scroll, several moves can arrive in one frame.
+	* With Coalescing on, Up/Down/Left/Right/NavigateSteps queue their moves until the end of Slate's tick, then make
+	* each run of moves in the same direction as a single NavigateSteps(), so only the final Widget is highlighted.
+	* They return true once the move has been queued.  The native input path always coalesces.  Off by default.
+	*
+	* @param bCoalesce True to coalesce each frame's moves.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetNavigationCoalescing( bool bCoalesce, APlayerController* Player = nullptr );
+
+	/**
+	* The Navigator caches the navigable Widgets of each pushed Widget and only regenerates them when
+	* it detects a change (Push/Pop, Visibility/Enabled changes, Children added/removed or a Viewport resize).
+	* Call this if you have changed the layout in some other way, such as moving Widgets around, to force
+	* the next navigation to regenerate them.
+	*
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							InvalidateNavigableWidgets( APlayerController* Player = nullptr );
+
+	/**
+	* Sets how we search for the next Widget when navigating.  Linear (the default) checks every navigable
+	* Widget in turn.  Spatial Index only checks the Widgets near us in the direction of travel, which is
+	* much faster for large grids and lists, and picks the nearest Widget in that direction.
+	* Neighbour Graph makes the same choices as Spatial Index, but works them all out whenever the layout
+	* changes, so each move is just a lookup.  Use the console command ControllerNavigation.DumpNeighbourGraph
+	* to inspect it.
+	*
+	* @param Mode The ENavigationSearchMode to use.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetNavigationSearchMode( ENavigationSearchMode Mode, APlayerController* Player = nullptr );
+
+	/**
+	* Sets whether the Neighbour Graph of large layouts is built on a background thread (the default).  The layout
+	* change itself stays cheap, and moves made before the graph is ready use the Linear search instead.
+	* Turn it off to always have the graph as soon as the layout changes, at the cost of a hitch for large layouts.
+	*
+	* @param bBackground If true, build the Neighbour Graph in the background.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetBackgroundGraphBuild( bool bBackground, APlayerController* Player = nullptr );
+
+	/**
+	* Sets how the Linear search scores the Widgets it could navigate to.  Legacy (the default) is how the Navigator
+	* has always chosen.  Nearest Centre picks the closest Widget in the direction of travel.  Axis Aligned picks the
+	* closest Widget lined up with the current one (within the Navigation Threshold), and only looks further across if
+	* there isn't one.  Cone Weighted only considers Widgets within 45 degrees of the direction of travel, favouring
+	* those straight ahead.  Pick the cheapest that works for your layouts; the benchmark times each of them.
+	*
+	* @param Mode The ENavigationScoring to use.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetNavigationScoring( ENavigationScoring Mode, APlayerController* Player = nullptr );
+
+	/**
+	* Sets how many navigable Widgets a layer needs before the Nearest Centre, Axis Aligned and Cone Weighted scorings
+	* share the work across the task graph's threads.  They pick exactly the same Widget either way, it only changes
+	* how long it takes.  Below a few thousand Widgets it is quicker on one thread; the benchmark shows where the
+	* crossover is on your hardware.
+	*
+	* @param NumWidgets The fewest Widgets to score in parallel.  0 uses the default.
+	* @param Player The Player whose Navigator to use.  Defaults to the first Local Player's.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							SetParallelScoringThreshold( int32 NumWidgets, APlayerController* Player = nullptr );
+
+	/**
+	* Retrieves how often navigation was able to reuse the cached navigable Widgets, versus how often they
+	* had to be regenerated.  Useful for checking nothing is invalidating the cache every frame.
+	*
+	* @param CacheHits The number of times the cached Widgets were reused.
+	* @param CacheRebuilds The number of times the cached Widgets were regenerated.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							GetNavigationCacheStats( int32& CacheHits, int32& CacheRebuilds );
+
+	/**
+	* Retrieves how much work the last regeneration of the navigable Widgets did.  Every Widget that is on
+	* screen is visited once, so WidgetsVisited should grow in line with the size of your menus.
+	*
+	* @param WidgetsVisited The number of Widgets checked.
+	* @param WidgetsAccepted The number of those Widgets we can navigate to/through.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static void							GetEnumerationStats( int32& WidgetsVisited, int32& WidgetsAccepted );
+
+	/**
+	* Retrieves the number of times the Navigator has had to grow its scratch memory.  Once a menu has been
+	* navigated through, moving around it again shouldn't allocate at all, so this should stop counting up.
+	*
+	* This is a proxy, not an allocation hook: it counts the rebuilds and geometry captures after which the
+	* caches' allocated size had grown, so several allocations in one rebuild count once, and allocations
+	* made elsewhere (i.e. by UMG, or temporaries freed before the rebuild ends) aren't seen at all.  Use an
+	* LLM or Memory Insights capture to count every allocation.
+	*
+	* @return The number of times the Navigator's caches grew.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation" )
+		static int32						GetNavigationAllocationCount();
+
+	/**
+	* Logs the Up/Down/Left/Right neighbours of every navigable Widget on the top layer, alongside the Widget
+	* a Linear search would pick, so the two can be compared.  Bound to ControllerNavigation.DumpNeighbourGraph.
+	*/
+	static void								DumpNeighbourGraph();
+
+	/**
+	* Navigates straight from Slate's input, instead of waiting for you to call Up/Down/Left/Right/Select.  The keys are
+	* handled before they reach any Widget, so the move happens in the same frame, and each controller's keys only
+	* move their own Player's Navigator.  Off by default; the Blueprint functions keep working either way.
+	*
+	* @param bEnabled True to navigate from the mapped keys.
+	* @param bLoop If true, navigation will loop.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static void							SetNativeInputEnabled( bool bEnabled, bool bLoop = false );
+
+	/**
+	* Maps a key to a navigation Action for the native input path.  By default, the D-Pad, Left Stick and Arrow
+	* keys navigate, and the bottom Face Button and Enter select.
+	*
+	* @param Key The Keyboard or Gamepad key.
+	* @param Action What pressing it does.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static void							BindNavigationKey( FKey Key, ENavigationInputAction Action );
+
+	/**
+	* Stops a key from being used by the native input path.
+	* @param Key The Keyboard or Gamepad key.
+	*/
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static void							UnbindNavigationKey( FKey Key );
+
+	/** Restores the native input path's default keys. */
+	UFUNCTION( BlueprintCallable, Category = "Controller Navigation|Input" )
+		static void							ResetNavigationKeys();
+
 
 	UPROPERTY( BlueprintAssignable, Category = "Controller Navigation" )
 		FSliderHoverChange					OnSliderHover;
 
+	/** Broadcast whenever the navigated Widget changes.  Either Widget may be null. */
+	UPROPERTY( BlueprintAssignable, Category = "Controller Navigation" )
+		FNavigationFocusChange				OnNavigationFocusChanged;
+
+	/** Broadcast when Mouse Tracking hands the cursor between the Mouse and the Navigator. */
+	UPROPERTY( BlueprintAssignable, Category = "Controller Navigation" )
+		FNavigationInputModeChange			OnInputModeChanged;
+
 protected:
 
 	// --------------------------------------------------------------
@@ -175,8 +612,8 @@ protected:
 	// --------------------------------------------------------------
 
 	/**
-	* Loops through the Last item in the Widgets Array and attempts to generate
-	* the Array of NavigableObjects.
+	* Loops through the Last item in the Layers Array and attempts to generate
+	* the Array of NavigableObjects.  If the Layer's cached Widgets are still valid, they are reused.
 	*
 	* @return True if we have some widgets and we were able to generate our list of navigable ones. Otherwise false.
 	*/
@@ -184,35 +621,151 @@ protected:
 		bool								GenerateNavigableWidgets();
 
 	/**
-	* This function receives a Widget and then check if it is a supported Widget type
-	* and if so, add it to our our NavigableWidgets Array.
+	* Checks if the Layer's cached NavigableWidgets can still be used.
 	*
-	* @param Widget The UWidget pointer passed from the ForEachWidget() function.
+	* @param Layer The Layer to check.
+	* @return True if nothing has invalidated the Layer since it was generated, otherwise false.
 	*/
-	UFUNCTION()
-		void								PopulateSupportedWidgetsArray( UWidget* Widget );
+	bool									IsLayerCacheValid( const FNavigatorLayer& Layer ) const;
 
 	/**
+	* Walks down from the passed Widget, adding every supported Widget to the top Layer's NavigableWidgets.
 	* If a Widget, such as a button, is added to a Panel and this parent Panel is Hidden
 	* then all child Widgets (including our button) are hidden.  However, the Visibility
 	* value for all child Widgets does not change!
-	* This function checks through all parent (and grandparent/great-grandparent etc)
-	* ancestors, checking for visibility.
+	* So hidden and disabled Widgets are not walked in to at all, and neither are the inactive pages
+	* of a Widget Switcher.  Nested User Widgets are walked in to, however deep they are, and every
+	* Widget is visited exactly once.
+	*
+	* @param Widget The Widget to start from.
+	*/
+	void									GatherNavigableWidgets( UWidget* Widget );
+
+	/**
+	* This function receives a Widget and then check if it is a supported Widget type (one with a handler in
+	* FControllerNavigationWidgetRegistry) and if so, add it to the top Layer's NavigableWidgets Array.
 	*
-	* @param Widget The UWidget pointer passed to check for ancestral visibility.
-	* @return True if all ancestors are visible, otherwise false.
+	* @param Widget The UWidget pointer passed from GatherNavigableWidgets().
+	* @return True if the Widget is Visible and Enabled, so its children may be navigable too.
 	*/
 	UFUNCTION()
-		bool								IsAncestorVisible( UWidget* Widget );
+		bool								PopulateSupportedWidgetsArray( UWidget* Widget );
 
 	/**
 	* Performs the actual attempt to Navigate in the passed direction.
 	* @param Direction The ENavDirection we should navigate in.
 	* @param bLoop If true, loops to the opposite side.
+	* @param Steps How many times to move, only highlighting the Widget we end up on.
 	* @return True if successfully navigated, otherwise false.
 	*/
 	UFUNCTION()
-		bool								Navigate( ENavDirection Direction, bool bLoop );
+		bool								Navigate( ENavDirection Direction, bool bLoop, int32 Steps = 1 );
+
+	/**
+	* Regenerates the top Layer's navigable Widgets if it needs to, then navigates in the passed direction.
+	* @param Direction The ENavDirection we should navigate in.
+	* @param bLoop If true, loops to the opposite side.
+	* @param Steps How many times to move.
+	* @param bCoalesce If true, the move is queued with the rest of this frame's, and made after Slate's tick.
+	* @return True if successfully navigated (or queued), otherwise false.
+	*/
+	bool									NavigateInDirection( ENavDirection Direction, bool bLoop, int32 Steps = 1, bool bCoalesce = false );
+
+	/** @return True if moves can be queued until after Slate's tick. */
+	bool									CanCoalesceNavigation() const;
+
+	/**
+	* Activates CurNavigatedWidget, or clicks on it if we can't.
+	* @param bForceClick If true, always clicks, even if we have no navigated Widget.
+	*/
+	void									SelectNavigatedWidget( bool bForceClick );
+
+	/**
+	* Performs an Action from the native input path.
+	* @param Action What to do.
+	* @param bLoop If true, directions loop to the opposite side.
+	* @param bRepeat True if the key is being held, rather than just pressed.
+	* @return True if the key was used, and shouldn't be routed any further.
+	*/
+	bool									HandleNavigationInput( ENavigationInputAction Action, bool bLoop, bool bRepeat );
+
+	/**
+	* @return True if navigation must wait, because the top Layer hasn't been laid out yet, or there are already
+	* requests waiting for it.
+	*/
+	bool									ShouldDeferNavigation() const;
+
+	/**
+	* Queues a navigation request, to be performed after Slate's tick, once the top Layer has been laid out.
+	* @param Action What to do.
+	* @param bLoop If true, directions loop to the opposite side.
+	* @param Steps How many times to move in the direction.
+	*/
+	void									DeferNavigation( ENavigationInputAction Action, bool bLoop, int32 Steps );
+
+	/** Resolves the pending requests after Slate's next tick. */
+	void									WaitForLayout();
+
+	/** Drops every pending request, i.e. because the Layer they were for has been popped. */
+	void									ClearPendingNavigation();
+
+	/**
+	* Bound to Slate's Post Tick while requests are pending.  Once the top Layer has been laid out (or we have
+	* waited long enough), navigates to PendingInitialFocus, then performs the PendingInputs in order.
+	* @param DeltaTime Slate's tick time.
+	*/
+	void									ResolvePendingNavigation( float DeltaTime );
+
+	/**
+	* Finds the Widget to navigate to, using the current ENavigationSearchMode.
+	* The Layer's geometry snapshot is recaptured first, if it is out of date.
+	* @param Layer The Layer we are navigating through.
+	* @param FromIndex The index of the currently highlighted Widget, within the Layer's NavigableWidgets.
+	* @param Direction The ENavDirection we should navigate in.
+	* @param bLoop If true, loops to the opposite side when there is nothing in that direction.
+	* @return The Widget to navigate to, or nullptr if there is nothing in that direction.
+	*/
+	UWidget*								FindNavigationTarget( FNavigatorLayer& Layer, int32 FromIndex, ENavDirection Direction, bool bLoop );
+
+	/**
+	* Moves the List's selection by up to Steps items in the passed direction.  Tile Views move a whole row Up and Down.
+	* @param ListView The List (or Tile) View we are navigating within.
+	* @param Direction The ENavDirection we should navigate in.
+	* @param Steps The number of items to move by.
+	* @return The number of items moved, fewer than Steps if we reached the List's edge and should navigate out of it.
+	*/
+	int32									NavigateListView( UListView* ListView, ENavDirection Direction, int32 Steps );
+
+	/**
+	* Selects the List's item and scrolls it in to view.  The View only generates an entry Widget for it if it is needed.
+	* @param ListView The List (or Tile) View.
+	* @param Index The index of the item to select.
+	*/
+	void									SelectListViewIndex( UListView* ListView, int32 Index ) const;
+
+	/**
+	* @param ListView The List (or Tile) View.
+	* @return The number of items per row, which is always 1 for a List View.
+	*/
+	int32									GetListViewColumns( UListView* ListView ) const;
+
+	/**
+	* Searches the Layer's geometry snapshot, using the current ENavigationSearchMode and the configured threshold.
+	* @param Layer The Layer we are navigating through.
+	* @param FromIndex The index of the currently highlighted Widget, within the Layer's NavigableWidgets.
+	* @param Direction The ENavDirection we should navigate in.
+	* @param bLoop If true, loops to the opposite side when there is nothing in that direction.
+	* @return The index of the Widget to navigate to, or INDEX_NONE if there is nothing in that direction.
+	*/
+	int32									FindTargetIndex( const FNavigatorLayer& Layer, int32 FromIndex, ENavDirection Direction, bool bLoop ) const;
+
+	/**
+	* @param FromIndex The index, within the top Layer's NavigableWidgets, of the Widget we are moving from.
+	* @param Direction The direction to move in.
+	* @param bLoop If true, loops to the opposite side.
+	* @return The query FindTargetIndex() asks, with this Navigator's search mode, scoring and thresholds.
+	*/
+	FNavigationQuery						MakeNavigationQuery( int32 FromIndex, ENavDirection Direction, bool bLoop ) const;
 
 	/**
 	* Attempts to navigate to the target navigable Widget.
@@ -221,6 +774,101 @@ protected:
 	UFUNCTION()
 		void								NavigateToWidget( UWidget* Widget );
 
+	/**
+	* Navigates to the Widget now, or once the top Layer has been laid out if it hasn't been yet.
+	* @param Widget The Widget to navigate to.
+	*/
+	void									FocusWidget( UWidget* Widget );
+
+	/**
+	* Makes the passed Widget the navigated Widget, and un/hovers any Sliders involved.
+	* @param Widget The Widget we have navigated to.
+	*/
+	void									SetNavigatedWidget( UWidget* Widget );
+
+	/**
+	* Navigates off of CurNavigatedWidget, i.e. because its Layer was pushed over or popped, or the Mouse took over.
+	* Unhovers it when Cursorless, and broadcasts OnNavigationFocusChanged, so games can stop drawing their highlight.
+	*/
+	void									ClearNavigatedWidget();
+
+	/**
+	* @param Widget The navigated Widget.
+	* @return The Widget to move the cursor over, or hover, for it.  See FControllerNavigationWidgetHandler::GetHighlightWidget().
+	*/
+	UWidget*								GetHighlightWidget( UWidget* Widget ) const;
+
+	/**
+	* Called for every Mouse move by the native input path.  Hands the cursor to the Mouse, once it has moved far enough.
+	* @param ScreenPosition Where the cursor now is, in screen space.
+	* @param Delta How far the Mouse moved.
+	*/
+	void									HandleMouseMove( const FVector2D& ScreenPosition, const FVector2D& Delta );
+
+	/**
+	* Hands the cursor to the Mouse or the Navigator, if Mouse Tracking is on.
+	* @param Mode Who should have the cursor.
+	*/
+	void									SetInputMode( ENavigationInputMode Mode );
+
+	/**
+	* Hovers (and focuses) or unhovers the Widget's Slate Widget directly, as if the cursor had moved on or off of it.
+	* Used by Cursorless navigation.
+	* @param Widget The Widget to un/hover.  May be null.
+	* @param bHovered True to hover the Widget, false to unhover it.
+	*/
+	void									SetSlateHover( UWidget* Widget, bool bHovered ) const;
+
+	/**
+	* Activates the Widget directly, without going through Slate's mouse handling.
+	* @param Widget The Widget to activate.
+	* @return True if the Widget's handler activated it, otherwise false.
+	*/
+	bool									ActivateWidget( UWidget* Widget );
+
+	/**
+	* Sends a Left Mouse Button click.  In Cursorless mode it goes straight to CurNavigatedWidget,
+	* otherwise it goes through Slate, to whatever is under the cursor.
+	*/
+	void									SendSyntheticClick();
+
+	/**
+	* Slides CurNavigatedWidget, if it can be adjusted.
+	* @param Input The Axis value, from -1 to 1.
+	* @param Rate How much of the Widget's range a full Axis covers per second, before acceleration.
+	*/
+	void									SlideNavigatedWidget( float Input, float Rate );
+
+	/**
+	* Finds the ScrollBox that Scroll() should scroll: the nearest ScrollBox containing CurNavigatedWidget, even across
+	* User Widgets, or failing that the largest ScrollBox on the top Layer.
+	* @return The ScrollBox, or nullptr if there isn't one.
+	*/
+	UScrollBox*								ResolveScrollTarget() const;
+
+	/**
+	* Checks if the Layer's geometry snapshot is still usable, by comparing the passed Widget's live geometry to it.
+	* @param Layer The Layer we are navigating through.
+	* @param Index The Widget to check, within the Layer's NavigableWidgets.
+	* @return True if the snapshot (and anything built from it) is up to date.
+	*/
+	bool									IsGeometrySnapshotCurrent( const FNavigatorLayer& Layer, int32 Index ) const;
+
+	/**
+	* Reads the geometry of every one of the Layer's NavigableWidgets, once, and rebuilds its Spatial Index
+	* (and Neighbour Graph, if we are using it).
+	* @param Layer The Layer to capture.
+	*/
+	void									CaptureGeometrySnapshot( FNavigatorLayer& Layer );
+
+	/**
+	* Reads the Widget's cached geometry, or asks GeometryOverride if it is bound.
+	* @param Widget The Widget to read.
+	* @param OutCentre The Widget's centre, in absolute space.
+	* @param OutHalfSize Half of the Widget's size.
+	*/
+	void									GetWidgetGeometry( UWidget* Widget, FVector2D& OutCentre, FVector2D& OutHalfSize ) const;
+
 	// --------------------------------------------------------------
 	// STATIC PROPERTIES
 	// --------------------------------------------------------------
@@ -232,13 +880,9 @@ protected:
 	// INSTANCE PROPERTIES
 	// --------------------------------------------------------------
 
-	/** The Array of Widgets within the current instance. */
+	/** The Array of pushed Widgets (and their cached navigation state) within the current instance. */
 	UPROPERTY()
-		TArray<UUserWidget*>				Widgets;
-
-	/** The Array of Navigable Widgets.  I.e. The Widgets that we support navigating to/from. */
-	UPROPERTY()
-		TArray<UWidget*>					NavigableWidgets;
+		TArray<FNavigatorLayer>				Layers;
 
 	/** The current Widget we have navigated to. */
 	UPROPERTY()
@@ -248,6 +892,9 @@ protected:
 	UPROPERTY()
 		FVector2D							NavigatorCursorPosition;
 
+	/** The Widget the cursor was moved over, or hovered when Cursorless: CurNavigatedWidget, or a List's selected entry. */
+	TWeakObjectPtr<UWidget>					HighlightedWidget;
+
 	/** On screen cursor values have no rounding, but the calculated pixel/geometry positions of target widgets often will.
 	*	To account for this, we allow the cursor to be within a range before we consider it no longer handled by the Navigator.*/
 	UPROPERTY()
@@ -257,6 +904,134 @@ protected:
 	UPROPERTY()
 		bool								bHideCursorDuringNavigation;
 
+	/** The ScrollBox Scroll() scrolls, resolved for ScrollTargetSource. */
+	UPROPERTY()
+		UScrollBox*							ScrollTarget;
+
+	/** The navigated Widget ScrollTarget was resolved for. */
+	UPROPERTY()
+		UWidget*							ScrollTargetSource;
+
+	/** If false, ScrollTarget must be resolved again, i.e. because the Layers have changed. */
+	bool									bScrollTargetResolved;
+
+	/** The Widget Slide() is adjusting, while it is held. */
+	TWeakObjectPtr<UWidget>					SlideWidget;
+
+	/** The value being slid to, before stepping, so slow input still builds up to a step. */
+	float									SlideRawValue;
+
+	/** How long Slide() has been held, in seconds. */
+	float									SlideHoldTime;
+
+	/** The direction Slide() is held in, -1 or 1.  Reversing starts a new slide. */
+	float									SlideDirection;
+
+	/** The frame Slide() was last called on, so a frame without it releases the slide. */
+	uint64									LastSlideFrame;
+
+	/** How many times faster than its starting speed Slide() gets, and how many seconds it takes to get there. */
+	float									SlideMaxAcceleration;
+	float									SlideAccelerationTime;
+
+	/** If true, we navigate by hovering Widgets directly, instead of moving the cursor.  Defaults to false. */
+	UPROPERTY()
+		bool								bCursorlessNavigation;
+
+	/** If true, we track who has the cursor, from the Mouse moves passed to HandleMouseMove(). */
+	bool									bTrackMouse;
+
+	/** Who has the cursor. */
+	UPROPERTY()
+		ENavigationInputMode				InputMode;
+
+	/** Where the last cursor move we made left the cursor, in screen space. */
+	FVector2D								WarpScreenPosition;
+
+	/** How far the Mouse has moved, by itself, since we last navigated. */
+	float									MouseTravel;
+
+	/** How far the Mouse has to move to take the cursor back. */
+	float									MouseModeThreshold;
+
+	/** If false, this Navigator's Player has no cursor of their own, so we always navigate Cursorless. */
+	bool									bOwnsCursor;
+
+	/** The Slate User this Navigator's Player is, who Widgets are focused for. */
+	int32									SlateUserIndex;
+
+	/** How we search for the next Widget to navigate to. */
+	UPROPERTY()
+		ENavigationSearchMode				SearchMode;
+
+	/** How the Linear search scores candidates. */
+	UPROPERTY()
+		ENavigationScoring					Scoring;
+
+	/** If true, the Neighbour Graph of large layouts is built on the task graph. */
+	bool									bBackgroundGraphBuild;
+
+	/** Layers with at least this many navigable Widgets are scored in parallel. */
+	int32									ParallelScoringThreshold;
+
+	/** Navigation requests waiting for the top Layer to be laid out, or the end of Slate's tick. */
+	TArray<FNavigatorPendingInput>			PendingInputs;
+
+	/** The requests being performed by ResolvePendingNavigation(), kept to reuse their memory. */
+	TArray<FNavigatorPendingInput>			ResolvingInputs;
+
+	/** The Widget to navigate to once the top Layer has been laid out. */
+	UPROPERTY()
+		UWidget*							PendingInitialFocus;
+
+	/** The number of Slate ticks the pending requests have waited. */
+	int32									PendingFrames;
+
+	/** Our binding to Slate's Post Tick, only while requests are pending. */
+	FDelegateHandle							PostTickHandle;
+
+	/** True if the pending requests were made before the top Layer had been laid out. */
+	bool									bPendingLayout;
+
+	/** True while the pending requests are being performed, so they aren't deferred again. */
+	bool									bResolvingPendingNavigation;
+
+	/** If true, Up/Down/Left/Right/NavigateSteps moves are queued and made together after Slate's tick. */
+	UPROPERTY()
+		bool								bCoalesceNavigation;
+
+	/** If bound, used instead of the Widgets' cached geometry, and the cursor is no longer moved. */
+	FNavigatorGeometryOverride				GeometryOverride;
+
+	/** Layers that have been popped, kept so the next pushed Widget can reuse their memory. */
+	TArray<FNavigatorLayer>					SpareLayers;
+
+	/** Every Widget visited by the current (or last) GatherNavigableWidgets() pass. */
+	TSet<UWidget*>							VisitedWidgets;
+
+	/** The Named Slots of the Widgets GatherNavigableWidgets() is currently walking. */
+	TArray<FName>							ScratchSlotNames;
+
+	/** The number of Widgets visited by the last regeneration of a Layer's NavigableWidgets. */
+	UPROPERTY()
+		int32								LastWidgetsVisited;
+
+	/** The number of Widgets added to NavigableWidgets by the last regeneration. */
+	UPROPERTY()
+		int32								LastWidgetsAccepted;
+
+	/** The number of navigation requests that reused a Layer's cached NavigableWidgets. */
+	UPROPERTY()
+		int32								NavigationCacheHits;
+
+	/** The number of navigation requests that had to regenerate a Layer's NavigableWidgets. */
+	UPROPERTY()
+		int32								NavigationCacheRebuilds;
+
+	/** The number of times a Layer's caches, or the GatherNavigableWidgets() scratch, had to grow.  Measured from their allocated size, see GetNavigationAllocationCount(). */
+	UPROPERTY()
+		int32								NavigationAllocations;
+
 private:
 
 };
@@ -0,0 +1,20 @@
+// (C) Gaslight Games Ltd, 2017-2018.  All rights reserved.
+
+using UnrealBuildTool;
+
+public class ControllerNavigationCore : ModuleRules
+{
+	public ControllerNavigationCore( ReadOnlyTargetRules Target ) : base( Target )
+	{
+        PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		// The navigation algorithms only work on arrays of rects, so only ever depend on Core.
+		// Anything to do with Widgets belongs in the ControllerNavigation module.
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+			}
+			);
+	}
+}
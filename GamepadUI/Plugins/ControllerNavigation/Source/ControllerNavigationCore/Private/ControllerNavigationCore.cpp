@@ -0,0 +1,11 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+
+#include "NavigationCoreStats.h"
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, ControllerNavigationCore )
+
+DEFINE_STAT( STAT_ConNav_CandidatesScored );
+DEFINE_STAT( STAT_ConNav_BuildGraph );
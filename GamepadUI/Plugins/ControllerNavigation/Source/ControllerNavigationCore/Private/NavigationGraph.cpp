@@ -0,0 +1,34 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "NavigationGraph.h"
+
+void FNavigationGraph::Build( const FNavigationSnapshot& Snapshot, const FNavigationGrid& Grid )
+{
+	Neighbours.Reset( Snapshot.Num() * NumDirections );
+
+	for( int32 i = 0; i < Snapshot.Num(); ++i )
+	{
+		for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+		{
+			Neighbours.Add( Grid.FindNeighbour( Snapshot, i, GetDirectionVector( Direction ) ) );
+		}
+	}
+}
+
+void FNavigationGraph::Reset()
+{
+	Neighbours.Reset();
+}
+
+FVector2D FNavigationGraph::GetDirectionVector( int32 Direction )
+{
+	static const FVector2D Directions[NumDirections] =
+	{
+		FVector2D( 0.f, -1.f ),		// Up
+		FVector2D( 0.f, 1.f ),		// Down
+		FVector2D( -1.f, 0.f ),		// Left
+		FVector2D( 1.f, 0.f )		// Right
+	};
+
+	return Directions[Direction];
+}
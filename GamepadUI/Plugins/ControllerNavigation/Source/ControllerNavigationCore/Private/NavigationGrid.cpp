@@ -0,0 +1,194 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "NavigationGrid.h"
+
+#include "NavigationCoreStats.h"
+
+namespace
+{
+	/** Caps the grid's memory use for sparse layouts spread across a very large area. */
+	const int32 MaxCellsPerAxis = 256;
+}
+
+const float FNavigationGrid::OffAxisWeight = 2.f;
+
+FNavigationGrid::FNavigationGrid()
+	: Origin( FVector2D::ZeroVector )
+	, CellSize( 1.f )
+	, NumCellsX( 0 )
+	, NumCellsY( 0 )
+{
+}
+
+void FNavigationGrid::Build( const FNavigationSnapshot& Snapshot )
+{
+	Reset();
+
+	FBox2D Bounds( ForceInit );
+	float TotalExtent = 0.f;
+	int32 NumTargets = 0;
+
+	for( int32 i = 0; i < Snapshot.Num(); ++i )
+	{
+		if( !Snapshot.IsNavigable( i ) )
+		{
+			continue;
+		}
+
+		Bounds += Snapshot.GetCentre( i );
+		TotalExtent += FMath::Max( Snapshot.HalfWidth[i], Snapshot.HalfHeight[i] ) * 2.f;
+		++NumTargets;
+	}
+
+	if( NumTargets == 0 )
+	{
+		return;
+	}
+
+	// Aim for roughly one Widget per cell, as navigable Widgets are usually laid out edge to edge.
+	const FVector2D Extent = Bounds.GetSize();
+	CellSize = FMath::Max( TotalExtent / NumTargets, 1.f );
+	CellSize = FMath::Max( CellSize, FMath::Max( Extent.X, Extent.Y ) / MaxCellsPerAxis );
+
+	Origin = Bounds.Min;
+	NumCellsX = FMath::FloorToInt( Extent.X / CellSize ) + 1;
+	NumCellsY = FMath::FloorToInt( Extent.Y / CellSize ) + 1;
+
+	// Counting sort of the entries in to their cells, so every cell is a contiguous run of CellItems.
+	CellStart.SetNumZeroed( NumCellsX * NumCellsY + 1 );
+	for( int32 i = 0; i < Snapshot.Num(); ++i )
+	{
+		if( Snapshot.IsNavigable( i ) )
+		{
+			const FIntPoint Cell = GetCell( Snapshot.GetCentre( i ) );
+			++CellStart[Cell.Y * NumCellsX + Cell.X + 1];
+		}
+	}
+
+	for( int32 i = 1; i < CellStart.Num(); ++i )
+	{
+		CellStart[i] += CellStart[i - 1];
+	}
+
+	CellItems.SetNumUninitialized( NumTargets );
+	for( int32 i = 0; i < Snapshot.Num(); ++i )
+	{
+		if( Snapshot.IsNavigable( i ) )
+		{
+			const FIntPoint Cell = GetCell( Snapshot.GetCentre( i ) );
+			CellItems[CellStart[Cell.Y * NumCellsX + Cell.X]++] = i;
+		}
+	}
+
+	// Filling moved every start on to the next cell's start, so shift them back.
+	for( int32 i = CellStart.Num() - 1; i > 0; --i )
+	{
+		CellStart[i] = CellStart[i - 1];
+	}
+	CellStart[0] = 0;
+}
+
+void FNavigationGrid::Reset()
+{
+	NumCellsX = 0;
+	NumCellsY = 0;
+	CellStart.Reset();
+	CellItems.Reset();
+}
+
+int32 FNavigationGrid::FindNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, const FVector2D& Direction ) const
+{
+	if( !IsBuilt() || FromIndex < 0 || FromIndex >= Snapshot.Num() )
+	{
+		return INDEX_NONE;
+	}
+
+	const FVector2D From = Snapshot.GetCentre( FromIndex );
+	const FIntPoint FromCell = GetCell( From );
+
+	// Work in terms of "along" the direction of travel and "across" it, so one loop handles all four directions.
+	const bool bHorizontal = FMath::Abs( Direction.X ) > FMath::Abs( Direction.Y );
+	const int32 Step = ( ( bHorizontal ? Direction.X : Direction.Y ) > 0.f ) ? 1 : -1;
+
+	const int32 NumAlong = bHorizontal ? NumCellsX : NumCellsY;
+	const int32 NumAcross = bHorizontal ? NumCellsY : NumCellsX;
+	const int32 FromAlong = bHorizontal ? FromCell.X : FromCell.Y;
+	const int32 FromAcross = bHorizontal ? FromCell.Y : FromCell.X;
+	const float FromAlongPos = bHorizontal ? From.X : From.Y;
+	const float FromAcrossPos = bHorizontal ? From.Y : From.X;
+	const float OriginAlong = bHorizontal ? Origin.X : Origin.Y;
+	const float OriginAcross = bHorizontal ? Origin.Y : Origin.X;
+
+	float BestScore = MAX_flt;
+	int32 BestIndex = INDEX_NONE;
+	int32 NumScored = 0;
+
+	for( int32 Band = FromAlong; Band >= 0 && Band < NumAlong; Band += Step )
+	{
+		// The closest any entry in this band can be, along the direction of travel.
+		const float BandNear = ( Step > 0 ) ? OriginAlong + Band * CellSize - FromAlongPos
+											: FromAlongPos - ( OriginAlong + ( Band + 1 ) * CellSize );
+		const float BandLowerBound = FMath::Max( BandNear, 0.f );
+		if( BandLowerBound > BestScore )
+		{
+			break;
+		}
+
+		// Walk outwards across the band from our own cell, on both sides.
+		for( int32 Side = 0; Side < 2; ++Side )
+		{
+			const int32 AcrossStep = ( Side == 0 ) ? 1 : -1;
+			for( int32 Across = ( Side == 0 ) ? FromAcross : FromAcross - 1; Across >= 0 && Across < NumAcross; Across += AcrossStep )
+			{
+				// The closest any entry in this cell can be, across the direction of travel.
+				float CellNear = 0.f;
+				if( Across != FromAcross )
+				{
+					CellNear = ( AcrossStep > 0 ) ? OriginAcross + Across * CellSize - FromAcrossPos
+												  : FromAcrossPos - ( OriginAcross + ( Across + 1 ) * CellSize );
+				}
+
+				if( BandLowerBound + OffAxisWeight * FMath::Max( CellNear, 0.f ) > BestScore )
+				{
+					break;
+				}
+
+				const int32 CellIndex = bHorizontal ? ( Across * NumCellsX + Band ) : ( Band * NumCellsX + Across );
+				for( int32 Item = CellStart[CellIndex]; Item < CellStart[CellIndex + 1]; ++Item )
+				{
+					const int32 Candidate = CellItems[Item];
+					if( Candidate == FromIndex )
+					{
+						continue;
+					}
+
+					const FVector2D Delta = Snapshot.GetCentre( Candidate ) - From;
+					const float Along = ( bHorizontal ? Delta.X : Delta.Y ) * Step;
+					if( Along <= 0.f )
+					{
+						continue;
+					}
+
+					++NumScored;
+					const float Score = Along + OffAxisWeight * FMath::Abs( bHorizontal ? Delta.Y : Delta.X );
+					if( Score < BestScore || ( Score == BestScore && Candidate < BestIndex ) )
+					{
+						BestScore = Score;
+						BestIndex = Candidate;
+					}
+				}
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY( STAT_ConNav_CandidatesScored, NumScored );
+
+	return BestIndex;
+}
+
+FIntPoint FNavigationGrid::GetCell( const FVector2D& Position ) const
+{
+	return FIntPoint(
+		FMath::Clamp( FMath::FloorToInt( ( Position.X - Origin.X ) / CellSize ), 0, NumCellsX - 1 ),
+		FMath::Clamp( FMath::FloorToInt( ( Position.Y - Origin.Y ) / CellSize ), 0, NumCellsY - 1 ) );
+}
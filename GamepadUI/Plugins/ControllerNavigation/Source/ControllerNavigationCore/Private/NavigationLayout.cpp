@@ -0,0 +1,187 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "NavigationLayout.h"
+
+#include "NavigationCoreStats.h"
+
+FNavigationLayout::FNavigationLayout( const FNavigationLayout& Other )
+	: Snapshot( Other.Snapshot )
+	, Grid( Other.Grid )
+	, Graph( Other.Graph )
+{
+}
+
+FNavigationLayout& FNavigationLayout::operator=( const FNavigationLayout& Other )
+{
+	if( this != &Other )
+	{
+		// Two layouts publishing the same build would swap the wrong graphs, so the copy goes without.
+		AbandonGraphBuild();
+		SpareGraph.Reset();
+
+		Snapshot = Other.Snapshot;
+		Grid = Other.Grid;
+		Graph = Other.Graph;
+	}
+
+	return *this;
+}
+
+void FNavigationLayout::Reset( int32 ExpectedNum )
+{
+	AbandonGraphBuild();
+
+	Snapshot.Reset( ExpectedNum );
+	Grid.Reset();
+	Graph.Reset();
+}
+
+void FNavigationLayout::Build( bool bBuildGraph, bool bBackgroundGraph )
+{
+	AbandonGraphBuild();
+
+	Snapshot.Finalize();
+	Grid.Build( Snapshot );
+	Graph.Reset();
+
+	if( !bBuildGraph )
+	{
+		return;
+	}
+
+	if( bBackgroundGraph && Snapshot.Num() >= MinEntriesForBackgroundGraph && FPlatformProcess::SupportsMultithreading() )
+	{
+		BuildGraphInBackground();
+	}
+	else
+	{
+		Graph.Build( Snapshot, Grid );
+	}
+}
+
+void FNavigationLayout::BuildGraphInBackground()
+{
+	TSharedPtr<FGraphBuild, ESPMode::ThreadSafe> Build = SpareGraph.IsValid() ? SpareGraph : MakeShared<FGraphBuild, ESPMode::ThreadSafe>();
+	SpareGraph.Reset();
+
+	// The task only ever sees its own copy, so the game thread is free to carry on with the layout.
+	Build->Snapshot = Snapshot;
+	Build->Grid = Grid;
+
+	PendingGraph = Build;
+	PendingGraphEvent = FFunctionGraphTask::CreateAndDispatchWhenReady( [Build]()
+		{
+			SCOPE_CYCLE_COUNTER( STAT_ConNav_BuildGraph );
+			Build->Graph.Build( Build->Snapshot, Build->Grid );
+		},
+		GET_STATID( STAT_ConNav_BuildGraph ), nullptr, ENamedThreads::AnyBackgroundThreadNormalTask );
+}
+
+bool FNavigationLayout::PublishGraph()
+{
+	if( !PendingGraph.IsValid() || !PendingGraphEvent->IsComplete() )
+	{
+		return false;
+	}
+
+	// Swap the buffers, rather than copying, and keep the old front buffer for the next build to fill.
+	Swap( Graph, PendingGraph->Graph );
+	SpareGraph = PendingGraph;
+
+	PendingGraph.Reset();
+	PendingGraphEvent = nullptr;
+
+	return true;
+}
+
+void FNavigationLayout::WaitForGraph()
+{
+	if( PendingGraph.IsValid() )
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes( PendingGraphEvent );
+		PublishGraph();
+	}
+}
+
+void FNavigationLayout::AbandonGraphBuild()
+{
+	PendingGraph.Reset();
+	PendingGraphEvent = nullptr;
+}
+
+int32 FNavigationLayout::FindTarget( const FNavigationQuery& Query ) const
+{
+	if( Query.FromIndex < 0 || Query.FromIndex >= Snapshot.Num() )
+	{
+		return INDEX_NONE;
+	}
+
+	// Without its graph, including while it is built in the background, the Neighbour Graph search falls back to the Linear search.
+	int32 TargetIndex = INDEX_NONE;
+	if( Query.Search == ENavigationLayoutSearch::SpatialIndex )
+	{
+		TargetIndex = Grid.FindNeighbour( Snapshot, Query.FromIndex, FNavigationGraph::GetDirectionVector( Query.Direction ) );
+	}
+	else if( Query.Search == ENavigationLayoutSearch::NeighbourGraph && HasGraph() )
+	{
+		TargetIndex = Graph.GetNeighbour( Query.FromIndex, Query.Direction );
+	}
+	else if( Query.Scoring != ENavigationLayoutScoring::Legacy )
+	{
+		TargetIndex = FNavigationScoring::FindNeighbour( Snapshot, Query.FromIndex, Query.Direction, Query.Scoring, Query.NavigationThreshold, Query.ParallelThreshold );
+	}
+	else
+	{
+		TargetIndex = Snapshot.FindLinearNeighbour( Query.FromIndex, Query.Direction, Query.NavigationThreshold, Query.bEuclideanDown );
+	}
+
+	if( TargetIndex == INDEX_NONE && Query.bLoop )
+	{
+		TargetIndex = FindLoopTarget( Query.FromIndex, Query.Direction );
+	}
+
+	return TargetIndex;
+}
+
+int32 FNavigationLayout::FindLoopTarget( int32 FromIndex, int32 Direction ) const
+{
+	if( FromIndex < 0 || FromIndex >= Snapshot.Num() )
+	{
+		return INDEX_NONE;
+	}
+
+	// Looping Right starts again from the far Left, so we want the entry furthest back "along" the direction of travel,
+	// scored the same way as the Spatial Index so entries lined up with FromIndex are favoured.
+	const FVector2D DirectionVector = FNavigationGraph::GetDirectionVector( Direction );
+	const bool bHorizontal = FMath::Abs( DirectionVector.X ) > FMath::Abs( DirectionVector.Y );
+	const float Sign = bHorizontal ? DirectionVector.X : DirectionVector.Y;
+	const FVector2D From = Snapshot.GetCentre( FromIndex );
+
+	float BestScore = MAX_flt;
+	int32 BestIndex = INDEX_NONE;
+	int32 NumScored = 0;
+
+	for( int32 i = 0; i < Snapshot.Num(); ++i )
+	{
+		if( i == FromIndex || !Snapshot.IsNavigable( i ) )
+		{
+			continue;
+		}
+
+		const FVector2D Centre = Snapshot.GetCentre( i );
+		const float Along = ( bHorizontal ? Centre.X : Centre.Y ) * Sign;
+		const float Across = FMath::Abs( bHorizontal ? Centre.Y - From.Y : Centre.X - From.X );
+		const float Score = Along + FNavigationGrid::OffAxisWeight * Across;
+		++NumScored;
+
+		if( Score < BestScore )
+		{
+			BestScore = Score;
+			BestIndex = i;
+		}
+	}
+
+	INC_DWORD_STAT_BY( STAT_ConNav_CandidatesScored, NumScored );
+
+	return BestIndex;
+}
@@ -0,0 +1,65 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "NavigationScoring.h"
+
+#include "Async/TaskGraphInterfaces.h"
+#include "Misc/App.h"
+
+#include "NavigationCoreStats.h"
+
+int32 FNavigationScoring::GetNumTasks( int32 NumEntries, int32 ParallelThreshold, int32 MaxTasks )
+{
+	if( NumEntries < FMath::Max( ParallelThreshold, MinEntriesPerTask * 2 ) || !FPlatformProcess::SupportsMultithreading() || !FApp::ShouldUseThreadingForPerformance() )
+	{
+		return 1;
+	}
+
+	// One task per worker, plus the calling thread, which ParallelFor() also puts to work.
+	int32 NumTasks = FMath::Min( NumEntries / MinEntriesPerTask, FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 );
+	if( MaxTasks > 0 )
+	{
+		NumTasks = FMath::Min( NumTasks, MaxTasks );
+	}
+
+	return FMath::Clamp<int32>( NumTasks, 1, MaxInlineTasks );
+}
+
+template<typename PolicyType>
+int32 FNavigationScoring::FindNeighbourInDirection( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction, const PolicyType& Policy,
+												   int32 ParallelThreshold, int32 MaxTasks )
+{
+	switch( Direction )
+	{
+		case 0:		return FindNeighbour<PolicyType, 1, -1>( Snapshot, FromIndex, Policy, ParallelThreshold, MaxTasks );	// Up
+		case 1:		return FindNeighbour<PolicyType, 1, 1>( Snapshot, FromIndex, Policy, ParallelThreshold, MaxTasks );		// Down
+		case 2:		return FindNeighbour<PolicyType, 0, -1>( Snapshot, FromIndex, Policy, ParallelThreshold, MaxTasks );	// Left
+		default:	return FindNeighbour<PolicyType, 0, 1>( Snapshot, FromIndex, Policy, ParallelThreshold, MaxTasks );		// Right
+	}
+}
+
+int32 FNavigationScoring::FindNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction, ENavigationLayoutScoring Scoring, float NavigationThreshold,
+										int32 ParallelThreshold, int32 MaxTasks )
+{
+	if( FromIndex < 0 || FromIndex >= Snapshot.Num() )
+	{
+		return INDEX_NONE;
+	}
+
+	INC_DWORD_STAT_BY( STAT_ConNav_CandidatesScored, Snapshot.Num() - 1 );
+
+	switch( Scoring )
+	{
+		case ENavigationLayoutScoring::NearestCentre:
+			return FindNeighbourInDirection( Snapshot, FromIndex, Direction, NavigationScoring::FNearestCentre(), ParallelThreshold, MaxTasks );
+
+		case ENavigationLayoutScoring::AxisAligned:
+			return FindNeighbourInDirection( Snapshot, FromIndex, Direction, NavigationScoring::FAxisAligned( NavigationThreshold ), ParallelThreshold, MaxTasks );
+
+		case ENavigationLayoutScoring::ConeWeighted:
+			return FindNeighbourInDirection( Snapshot, FromIndex, Direction, NavigationScoring::FConeWeighted(), ParallelThreshold, MaxTasks );
+
+		default:
+			checkNoEntry();
+			return INDEX_NONE;
+	}
+}
@@ -0,0 +1,189 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "NavigationSnapshot.h"
+
+#include "NavigationCoreStats.h"
+
+#include "Math/VectorRegister.h"
+
+FNavigationSnapshot::FNavigationSnapshot()
+	: NumEntries( 0 )
+{
+}
+
+void FNavigationSnapshot::Reset( int32 ExpectedNum )
+{
+	const int32 ExpectedPadded = Align( ExpectedNum, (int32)BlockSize );
+
+	CentreX.Reset( ExpectedPadded );
+	CentreY.Reset( ExpectedPadded );
+	HalfWidth.Reset( ExpectedPadded );
+	HalfHeight.Reset( ExpectedPadded );
+	Flags.Reset( ExpectedPadded );
+	NumEntries = 0;
+}
+
+void FNavigationSnapshot::Add( const FVector2D& Centre, const FVector2D& HalfSize, uint8 EntryFlags )
+{
+	checkSlow( CentreX.Num() == NumEntries );
+
+	CentreX.Add( Centre.X );
+	CentreY.Add( Centre.Y );
+	HalfWidth.Add( HalfSize.X );
+	HalfHeight.Add( HalfSize.Y );
+	Flags.Add( EntryFlags );
+	++NumEntries;
+}
+
+void FNavigationSnapshot::Finalize()
+{
+	// Padding sits at 0,0 with no flags, which the kernel never picks.
+	const int32 NumPadding = Align( NumEntries, (int32)BlockSize ) - NumEntries;
+
+	CentreX.AddZeroed( NumPadding );
+	CentreY.AddZeroed( NumPadding );
+	HalfWidth.AddZeroed( NumPadding );
+	HalfHeight.AddZeroed( NumPadding );
+	Flags.AddZeroed( NumPadding );
+}
+
+SIZE_T FNavigationSnapshot::GetAllocatedSize() const
+{
+	return CentreX.GetAllocatedSize() + CentreY.GetAllocatedSize() + HalfWidth.GetAllocatedSize() + HalfHeight.GetAllocatedSize() + Flags.GetAllocatedSize();
+}
+
+int32 FNavigationSnapshot::FindLinearNeighbour( int32 FromIndex, int32 Direction, float NavigationThreshold, bool bEuclideanDown ) const
+{
+	if( FromIndex < 0 || FromIndex >= NumEntries )
+	{
+		return INDEX_NONE;
+	}
+
+	// Work in terms of "along" the direction of travel and "across" it, so one kernel handles all four directions.
+	const bool bVertical = ( Direction <= 1 );
+	const float Sign = ( Direction == 1 || Direction == 3 ) ? 1.f : -1.f;
+	const bool bEuclidean = bEuclideanDown && Direction == 1;
+
+	// Left and Right only start on a candidate within the threshold, Up and Down start on anything.
+	const bool bFirstNeedsThreshold = !bVertical;
+
+	const float* AlongPos = bVertical ? CentreY.GetData() : CentreX.GetData();
+	const float* AcrossPos = bVertical ? CentreX.GetData() : CentreY.GetData();
+	const float FromAlong = AlongPos[FromIndex];
+	const float FromAcross = AcrossPos[FromIndex];
+	const float FromX = CentreX[FromIndex];
+	const float FromY = CentreY[FromIndex];
+
+	int32 BestIndex = INDEX_NONE;
+	float BestAlong = 0.f;
+	float BestAcross = 0.f;
+	float BestDistSquared = 0.f;
+	float BestDist = 0.f;
+	int32 NumScored = 0;
+
+	// Folds a single candidate in, exactly as the original loop did.  The order candidates are visited in matters.
+	const auto TryCandidate = [ & ]( int32 Index, float Along, float Across )
+	{
+		const float DeltaX = FromX - CentreX[Index];
+		const float DeltaY = FromY - CentreY[Index];
+		const float DistSquared = DeltaX * DeltaX + DeltaY * DeltaY;
+		++NumScored;
+
+		bool bAccept = false;
+		if( BestIndex == INDEX_NONE )
+		{
+			bAccept = !bFirstNeedsThreshold ||
+				( AcrossPos[Index] < FromAcross + NavigationThreshold && AcrossPos[Index] > FromAcross - NavigationThreshold );
+		}
+		else if( bEuclidean )
+		{
+			const float Dist = FMath::Sqrt( DistSquared );
+			bAccept = ( Dist < BestDist && Dist > 0 && BestDist > 0 );
+		}
+		else if( Along <= BestAlong && Along > 0 && BestAlong > 0 )
+		{
+			bAccept = ( Across - NavigationThreshold < BestAcross || Across + NavigationThreshold < BestAcross );
+		}
+
+		if( bAccept )
+		{
+			BestIndex = Index;
+			BestAlong = Along;
+			BestAcross = Across;
+			BestDistSquared = DistSquared;
+			BestDist = FMath::Sqrt( DistSquared );
+		}
+	};
+
+	const VectorRegister VecZero = VectorZero();
+	const VectorRegister VecSign = VectorSetFloat1( Sign );
+	const VectorRegister VecFromAlong = VectorSetFloat1( FromAlong );
+	const VectorRegister VecFromAcross = VectorSetFloat1( FromAcross );
+	const VectorRegister VecThreshold = VectorSetFloat1( NavigationThreshold );
+
+	float AlongLanes[BlockSize];
+	float AcrossLanes[BlockSize];
+
+	for( int32 Block = 0; Block < CentreX.Num(); Block += BlockSize )
+	{
+		const VectorRegister VecAlongPos = VectorLoad( AlongPos + Block );
+		const VectorRegister VecAlong = VectorMultiply( VectorSubtract( VecAlongPos, VecFromAlong ), VecSign );
+		const VectorRegister VecAcross = VectorAbs( VectorSubtract( VectorLoad( AcrossPos + Block ), VecFromAcross ) );
+
+		// Candidates must be in the direction of travel, and (as before) not sat on zero along it.
+		int32 Mask = VectorMaskBits( VectorBitwiseAnd( VectorCompareGT( VecAlong, VecZero ), VectorCompareNE( VecAlongPos, VecZero ) ) );
+		for( int32 Lane = 0; Lane < BlockSize; ++Lane )
+		{
+			if( ( Flags[Block + Lane] & Flag_Target ) == 0 || Block + Lane == FromIndex )
+			{
+				Mask &= ~( 1 << Lane );
+			}
+		}
+
+		if( Mask == 0 )
+		{
+			continue;
+		}
+
+		if( BestIndex != INDEX_NONE )
+		{
+			// Skip the whole block if no candidate could replace our current choice.  The choice can't change
+			// without a replacement, so this never changes the result.
+			VectorRegister VecCouldReplace;
+			if( bEuclidean )
+			{
+				const VectorRegister VecDistSquared = VectorAdd( VectorMultiply( VecAlong, VecAlong ), VectorMultiply( VecAcross, VecAcross ) );
+				VecCouldReplace = VectorCompareGT( VectorSetFloat1( BestDistSquared ), VecDistSquared );
+			}
+			else
+			{
+				const VectorRegister VecBestAcross = VectorSetFloat1( BestAcross );
+				VecCouldReplace = VectorBitwiseAnd(
+					VectorCompareGE( VectorSetFloat1( BestAlong ), VecAlong ),
+					VectorBitwiseOr(
+						VectorCompareGT( VecBestAcross, VectorSubtract( VecAcross, VecThreshold ) ),
+						VectorCompareGT( VecBestAcross, VectorAdd( VecAcross, VecThreshold ) ) ) );
+			}
+
+			if( ( Mask & VectorMaskBits( VecCouldReplace ) ) == 0 )
+			{
+				continue;
+			}
+		}
+
+		// An earlier lane can change our choice, so fold every candidate in the block, in order.
+		VectorStore( VecAlong, AlongLanes );
+		VectorStore( VecAcross, AcrossLanes );
+		for( int32 Lane = 0; Lane < BlockSize; ++Lane )
+		{
+			if( Mask & ( 1 << Lane ) )
+			{
+				TryCandidate( Block + Lane, AlongLanes[Lane], AcrossLanes[Lane] );
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY( STAT_ConNav_CandidatesScored, NumScored );
+
+	return BestIndex;
+}
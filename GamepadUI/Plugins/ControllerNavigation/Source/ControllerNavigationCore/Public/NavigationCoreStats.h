@@ -0,0 +1,12 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+// The stat group is shared with the ControllerNavigation module, see ControllerNavigationStats.h.
+DECLARE_STATS_GROUP( TEXT( "Controller Navigation" ), STATGROUP_ControllerNavigation, STATCAT_Advanced );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN( TEXT( "Candidates Scored" ), STAT_ConNav_CandidatesScored, STATGROUP_ControllerNavigation, CONTROLLERNAVIGATIONCORE_API );
+DECLARE_CYCLE_STAT_EXTERN( TEXT( "BuildNeighbourGraph" ), STAT_ConNav_BuildGraph, STATGROUP_ControllerNavigation, CONTROLLERNAVIGATIONCORE_API );
@@ -0,0 +1,57 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NavigationGrid.h"
+
+/**
+* A precomputed Up/Down/Left/Right neighbour table for a layer's navigable Widgets.
+* Built once per layout change, after which every directional move is a single lookup.
+*
+* Directions are indexed in the same order as ENavDirection: Up, Down, Left, Right.
+*/
+class CONTROLLERNAVIGATIONCORE_API FNavigationGraph
+{
+public:
+	enum { NumDirections = 4 };
+
+	/**
+	* Computes the neighbours of every entry, using the Spatial Index built from the same snapshot.
+	*
+	* @param Snapshot The geometry snapshot to build the neighbours of.
+	* @param Grid The FNavigationGrid built from Snapshot.
+	*/
+	void									Build( const FNavigationSnapshot& Snapshot, const FNavigationGrid& Grid );
+
+	/** Empties the graph. */
+	void									Reset();
+
+	/** @return The number of bytes allocated by the graph. */
+	SIZE_T									GetAllocatedSize() const { return Neighbours.GetAllocatedSize(); }
+
+	/** @return The number of entries the graph was built for. */
+	int32									Num() const { return Neighbours.Num() / NumDirections; }
+
+	/**
+	* @param Index The entry to move from.
+	* @param Direction The direction to move in (Up, Down, Left, Right).
+	* @return The index of the neighbouring entry, or INDEX_NONE if there isn't one.
+	*/
+	int32									GetNeighbour( int32 Index, int32 Direction ) const
+	{
+		return Neighbours[Index * NumDirections + Direction];
+	}
+
+	/**
+	* @param Direction The direction (Up, Down, Left, Right).
+	* @return A unit vector pointing in that direction, in screen space (Y down).
+	*/
+	static FVector2D						GetDirectionVector( int32 Direction );
+
+private:
+
+	/** NumDirections neighbours per snapshot entry. */
+	TArray<int32>							Neighbours;
+};
@@ -0,0 +1,73 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "NavigationSnapshot.h"
+
+/**
+* A uniform grid over the centres of a layer's navigable Widgets.
+* A directional query only visits the cells that could hold a better candidate than the
+* best one found so far, so dense layouts (large inventories, map legends) navigate in
+* near-constant time instead of scanning every Widget.
+*/
+class CONTROLLERNAVIGATIONCORE_API FNavigationGrid
+{
+public:
+	FNavigationGrid();
+
+	/**
+	* Buckets the navigable entries of the passed snapshot in to the grid.  The snapshot is not copied,
+	* so it must outlive any call to FindNeighbour().
+	*
+	* @param Snapshot The geometry snapshot to index.
+	*/
+	void									Build( const FNavigationSnapshot& Snapshot );
+
+	/** Empties the grid. */
+	void									Reset();
+
+	/** @return The number of bytes allocated by the grid. */
+	SIZE_T									GetAllocatedSize() const { return CellStart.GetAllocatedSize() + CellItems.GetAllocatedSize(); }
+
+	/** @return True if Build() has been called since the last Reset(). */
+	bool									IsBuilt() const { return NumCellsX > 0; }
+
+	/**
+	* Finds the best entry to move to from FromIndex, in the passed Direction.
+	* Candidates must lie strictly in Direction (by centre) and are scored as the distance along
+	* Direction plus OffAxisWeight times the distance across it.  Lowest score wins, ties go to the
+	* lowest index.
+	*
+	* @param Snapshot The same snapshot the grid was built from.
+	* @param FromIndex The index of the entry we are moving from.
+	* @param Direction A unit vector for the direction of travel, i.e. (0, -1) for Up.
+	* @return The index of the best entry, or INDEX_NONE if there is nothing in that direction.
+	*/
+	int32									FindNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, const FVector2D& Direction ) const;
+
+	/** How heavily distance across the direction of travel is penalised, relative to distance along it. */
+	static const float						OffAxisWeight;
+
+private:
+
+	/** @return The cell coordinate containing the passed position, clamped to the grid. */
+	FIntPoint								GetCell( const FVector2D& Position ) const;
+
+	/** The top-left corner of the grid, in absolute space. */
+	FVector2D								Origin;
+
+	/** The width and height of every cell. */
+	float									CellSize;
+
+	/** The number of columns and rows in the grid. */
+	int32									NumCellsX;
+	int32									NumCellsY;
+
+	/** CellStart[i] is the first entry of CellItems in cell i, CellStart[i + 1] is one past its last. */
+	TArray<int32>							CellStart;
+
+	/** The snapshot indices in each cell, packed together cell by cell. */
+	TArray<int32>							CellItems;
+};
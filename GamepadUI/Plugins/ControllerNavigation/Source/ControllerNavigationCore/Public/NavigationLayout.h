@@ -0,0 +1,196 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
+
+#include "NavigationGraph.h"
+#include "NavigationGrid.h"
+#include "NavigationScoring.h"
+#include "NavigationSnapshot.h"
+
+/** The ways FNavigationLayout can search for the next entry.  In the same order as ENavigationSearchMode. */
+enum class ENavigationLayoutSearch : uint8
+{
+	Linear,
+	SpatialIndex,
+	NeighbourGraph
+};
+
+/** A single "which entry do we move to?" question. */
+struct FNavigationQuery
+{
+	FNavigationQuery()
+		: FromIndex( INDEX_NONE )
+		, Direction( 0 )
+		, Search( ENavigationLayoutSearch::Linear )
+		, Scoring( ENavigationLayoutScoring::Legacy )
+		, NavigationThreshold( 0.f )
+		, ParallelThreshold( FNavigationScoring::DefaultParallelThreshold )
+		, bEuclideanDown( true )
+		, bLoop( false )
+	{}
+
+	/** The index of the entry we are moving from. */
+	int32									FromIndex;
+
+	/** The direction to move in (Up, Down, Left, Right). */
+	int32									Direction;
+
+	/** How to search. */
+	ENavigationLayoutSearch					Search;
+
+	/** How the Linear search scores candidates. */
+	ENavigationLayoutScoring				Scoring;
+
+	/** The Linear search's Navigation Threshold, also used by the AxisAligned scoring. */
+	float									NavigationThreshold;
+
+	/** Layouts with at least this many entries are scored in parallel, by the Linear search's non-Legacy scorings. */
+	int32									ParallelThreshold;
+
+	/** If true, the Legacy scoring picks Down by straight line distance. */
+	bool									bEuclideanDown;
+
+	/** If true, and there is nothing in Direction, loop round to the opposite side. */
+	bool									bLoop;
+};
+
+/**
+* The geometry of a layer's navigable Widgets, as plain rects, plus everything built from it to search it.
+* This holds all of the decisions about where to navigate to, without knowing anything about Widgets,
+* so it can be run (and profiled) without the engine.
+*
+* Directions are indexed in the same order as ENavDirection: Up, Down, Left, Right.
+*/
+class CONTROLLERNAVIGATIONCORE_API FNavigationLayout
+{
+public:
+
+	/** Layouts with fewer entries than this always build their Neighbour Graph straight away, it isn't worth a task. */
+	static const int32						MinEntriesForBackgroundGraph = 256;
+
+	FNavigationLayout() {}
+
+	/** Copies the entries and everything built from them, but not a Neighbour Graph still being built in the background. */
+	FNavigationLayout( const FNavigationLayout& Other );
+	FNavigationLayout&						operator=( const FNavigationLayout& Other );
+
+	/**
+	* Moves everything, including a Neighbour Graph being built in the background and the spare graph buffer, and keeps
+	* every array's slack.  Layers are moved between the Navigator's active and spare stacks, so this must stay cheap.
+	*/
+	FNavigationLayout( FNavigationLayout&& Other ) = default;
+	FNavigationLayout&						operator=( FNavigationLayout&& Other ) = default;
+
+	/**
+	* Empties the layout, keeping its memory.
+	* @param ExpectedNum The number of entries about to be added.
+	*/
+	void									Reset( int32 ExpectedNum = 0 );
+
+	/**
+	* Adds an entry.
+	* @param Centre The centre of the rect.
+	* @param HalfSize Half of the rect's size.
+	* @param EntryFlags Any combination of FNavigationSnapshot::EFlags.
+	*/
+	void									Add( const FVector2D& Centre, const FVector2D& HalfSize, uint8 EntryFlags )
+	{
+		Snapshot.Add( Centre, HalfSize, EntryFlags );
+	}
+
+	/**
+	* Builds the search structures.  Call after the last Add().
+	* @param bBuildGraph If true, the Neighbour Graph is built too.  Only pay for it when it is going to be used.
+	* @param bBackgroundGraph If true, the Neighbour Graph is built on the task graph, from a copy of the entries.
+	*		Until PublishGraph() picks it up, FindTarget() uses the Linear search.
+	*/
+	void									Build( bool bBuildGraph, bool bBackgroundGraph = false );
+
+	/**
+	* Swaps in the Neighbour Graph built in the background, if it has finished.  Game thread only.
+	* @return True if a graph was published.
+	*/
+	bool									PublishGraph();
+
+	/** Blocks until the Neighbour Graph being built in the background has finished, then publishes it. */
+	void									WaitForGraph();
+
+	/** @return True while the Neighbour Graph for the current entries is being built in the background. */
+	bool									IsBuildingGraph() const { return PendingGraph.IsValid(); }
+
+	/** @return The number of entries. */
+	int32									Num() const { return Snapshot.Num(); }
+
+	/** @return True if the Neighbour Graph was built for the current entries. */
+	bool									HasGraph() const { return Graph.Num() == Snapshot.Num(); }
+
+	/** @return The entries' geometry. */
+	const FNavigationSnapshot&				GetSnapshot() const { return Snapshot; }
+
+	/** @return The number of bytes allocated by the layout. */
+	SIZE_T									GetAllocatedSize() const
+	{
+		// The graph being built belongs to the worker until it is published, so isn't counted until then.
+		return Snapshot.GetAllocatedSize() + Grid.GetAllocatedSize() + Graph.GetAllocatedSize()
+			+ ( SpareGraph.IsValid() ? SpareGraph->GetAllocatedSize() : 0 )
+			+ ( PendingGraph.IsValid() ? PendingGraph->Snapshot.GetAllocatedSize() + PendingGraph->Grid.GetAllocatedSize() : 0 );
+	}
+
+	/**
+	* Answers the passed query.  If it asks for the Neighbour Graph, and that hasn't been built, the Linear search is used.
+	* @param Query The query.
+	* @return The index of the entry to move to, or INDEX_NONE if there isn't one.
+	*/
+	int32									FindTarget( const FNavigationQuery& Query ) const;
+
+	/**
+	* Finds where moving off of the edge of the layout should loop round to: the entry furthest back in Direction,
+	* favouring those lined up with FromIndex.
+	* @param FromIndex The index of the entry we are moving from.
+	* @param Direction The direction to move in (Up, Down, Left, Right).
+	* @return The index of the entry to loop to, or INDEX_NONE if there isn't one.
+	*/
+	int32									FindLoopTarget( int32 FromIndex, int32 Direction ) const;
+
+private:
+
+	/** A Neighbour Graph being built on the task graph, from its own copy of the entries so they can't change underneath it. */
+	struct FGraphBuild
+	{
+		FNavigationSnapshot					Snapshot;
+		FNavigationGrid						Grid;
+		FNavigationGraph					Graph;
+
+		SIZE_T								GetAllocatedSize() const
+		{
+			return Snapshot.GetAllocatedSize() + Grid.GetAllocatedSize() + Graph.GetAllocatedSize();
+		}
+	};
+
+	/** Copies the entries, and kicks off building their Neighbour Graph on the task graph. */
+	void									BuildGraphInBackground();
+
+	/** Forgets about any Neighbour Graph being built in the background.  The task still finishes, but its result is thrown away. */
+	void									AbandonGraphBuild();
+
+	/** The entries' packed geometry. */
+	FNavigationSnapshot						Snapshot;
+
+	/** Spatial index over Snapshot. */
+	FNavigationGrid							Grid;
+
+	/** Neighbours of every Snapshot entry, only built on request.  The front buffer, only ever touched on the game thread. */
+	FNavigationGraph						Graph;
+
+	/** The build in flight, if any.  Shared with its task, so it outlives the layout if it has to. */
+	TSharedPtr<FGraphBuild, ESPMode::ThreadSafe>	PendingGraph;
+
+	/** Completes when PendingGraph has been built. */
+	FGraphEventRef							PendingGraphEvent;
+
+	/** The last published build, whose Graph holds the previous front buffer.  Reused by the next build, to save reallocating. */
+	TSharedPtr<FGraphBuild, ESPMode::ThreadSafe>	SpareGraph;
+};
@@ -0,0 +1,233 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
+
+#include "NavigationSnapshot.h"
+
+/** How the Linear search scores candidates.  In the same order as ENavigationScoring. */
+enum class ENavigationLayoutScoring : uint8
+{
+	Legacy,
+	NearestCentre,
+	AxisAligned,
+	ConeWeighted
+};
+
+/**
+* Scoring policies for FNavigationScoring::FindNeighbour().  Each is passed a candidate's distance Along the direction
+* of travel (always above zero) and Across it (never negative), and either rejects it, or gives it a Tier and a Score.
+* The lowest Tier wins, then the lowest Score, then the lowest index.
+*/
+namespace NavigationScoring
+{
+	/** The nearest candidate by straight line distance. */
+	struct FNearestCentre
+	{
+		FORCEINLINE bool Score( float Along, float Across, int32& OutTier, float& OutScore ) const
+		{
+			OutTier = 0;
+			OutScore = Along * Along + Across * Across;
+			return true;
+		}
+	};
+
+	/** The nearest candidate lined up (within Threshold) with where we are, or if nothing is, the nearest of the rest. */
+	struct FAxisAligned
+	{
+		explicit FAxisAligned( float InThreshold )
+			: Threshold( InThreshold )
+		{}
+
+		FORCEINLINE bool Score( float Along, float Across, int32& OutTier, float& OutScore ) const
+		{
+			OutTier = ( Across <= Threshold ) ? 0 : 1;
+			OutScore = Along + Across;
+			return true;
+		}
+
+		/** How far across the direction of travel a candidate can be and still be lined up. */
+		float								Threshold;
+	};
+
+	/** The nearest candidate within a 90 degree cone, with distance stretched the further it is off the direction of travel. */
+	struct FConeWeighted
+	{
+		FORCEINLINE bool Score( float Along, float Across, int32& OutTier, float& OutScore ) const
+		{
+			if( Across > Along )
+			{
+				return false;
+			}
+
+			OutTier = 0;
+			OutScore = ( Along * Along + Across * Across ) * ( 1.f + AngleWeight * ( Across / Along ) );
+			return true;
+		}
+
+		/** How much being at the edge of the cone stretches a candidate's distance (1 doubles it). */
+		static constexpr float				AngleWeight = 1.f;
+	};
+}
+
+/**
+* Searches a snapshot with one of the scoring policies.  Each policy is compiled for each direction of travel, so the
+* axis and sign are constants within the search, and the policy is picked once per query, not per candidate.
+*
+* Directions are indexed in the same order as ENavDirection: Up, Down, Left, Right.
+*/
+class CONTROLLERNAVIGATIONCORE_API FNavigationScoring
+{
+public:
+
+	/** Searches of fewer entries than this are scored on the calling thread, as spreading them over threads costs more than it saves. */
+	static const int32						DefaultParallelThreshold = 4096;
+
+	/** The fewest entries a parallel search gives each of its tasks. */
+	static const int32						MinEntriesPerTask = 1024;
+
+	/**
+	* Finds the best entry to move to from FromIndex, using the passed scoring.
+	* @param Snapshot The geometry to search.
+	* @param FromIndex The index of the entry we are moving from.
+	* @param Direction The direction to move in (Up, Down, Left, Right).
+	* @param Scoring The scoring to use.  Legacy is FNavigationSnapshot::FindLinearNeighbour(), so isn't handled here.
+	* @param NavigationThreshold The configured Navigation Threshold, used by AxisAligned.
+	* @param ParallelThreshold Snapshots with at least this many entries are scored on the task graph.
+	* @param MaxTasks The most tasks to split a parallel search into, or 0 for as many as it is worth.
+	* @return The index of the entry to move to, or INDEX_NONE if there isn't one.
+	*/
+	static int32							FindNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction, ENavigationLayoutScoring Scoring, float NavigationThreshold,
+														   int32 ParallelThreshold = DefaultParallelThreshold, int32 MaxTasks = 0 );
+
+	/**
+	* The search itself, for a single policy and direction.  Candidates must be navigable and strictly ahead of FromIndex.
+	* Large snapshots are split into contiguous chunks scored in parallel, then reduced in index order with the same
+	* tie-breaks, so the result is always the one the serial search would have picked.
+	*
+	* @param Snapshot The geometry to search.
+	* @param FromIndex The index of the entry we are moving from.
+	* @param Policy The scoring policy.
+	* @param ParallelThreshold Snapshots with at least this many entries are scored on the task graph.
+	* @param MaxTasks The most tasks to split a parallel search into, or 0 for as many as it is worth.
+	* @return The index of the entry to move to, or INDEX_NONE if there isn't one.
+	*/
+	template<typename PolicyType, int32 Axis, int32 Sign>
+	static int32							FindNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, const PolicyType& Policy,
+														   int32 ParallelThreshold = DefaultParallelThreshold, int32 MaxTasks = 0 )
+	{
+		static_assert( Axis == 0 || Axis == 1, "Axis must be 0 (X) or 1 (Y)." );
+		static_assert( Sign == 1 || Sign == -1, "Sign must be 1 or -1." );
+
+		const int32 NumEntries = Snapshot.Num();
+		const int32 NumTasks = GetNumTasks( NumEntries, ParallelThreshold, MaxTasks );
+		if( NumTasks <= 1 )
+		{
+			FCandidate Best;
+			ScoreRange<PolicyType, Axis, Sign>( Snapshot, FromIndex, Policy, 0, NumEntries, Best );
+			return Best.Index;
+		}
+
+		// Each task only writes its own slot, and scores a contiguous range, so its best is the lowest index of its ties.
+		TArray<FCandidate, TInlineAllocator<MaxInlineTasks>> TaskBest;
+		TaskBest.AddDefaulted( NumTasks );
+
+		const int32 EntriesPerTask = FMath::DivideAndRoundUp( NumEntries, NumTasks );
+		ParallelFor( NumTasks, [ &Snapshot, FromIndex, &Policy, &TaskBest, EntriesPerTask, NumEntries ]( int32 Task )
+		{
+			const int32 Begin = Task * EntriesPerTask;
+			ScoreRange<PolicyType, Axis, Sign>( Snapshot, FromIndex, Policy, Begin, FMath::Min( Begin + EntriesPerTask, NumEntries ), TaskBest[Task] );
+		} );
+
+		FCandidate Best;
+		for( const FCandidate& Candidate : TaskBest )
+		{
+			if( Candidate.IsBetterThan( Best ) )
+			{
+				Best = Candidate;
+			}
+		}
+
+		return Best.Index;
+	}
+
+private:
+
+	/** Parallel searches with up to this many tasks don't allocate. */
+	enum { MaxInlineTasks = 64 };
+
+	/** The best candidate found so far. */
+	struct FCandidate
+	{
+		FCandidate()
+			: Index( INDEX_NONE )
+			, Tier( MAX_int32 )
+			, Score( MAX_flt )
+		{}
+
+		/** @return True if this beats Other: the lowest Tier wins, then the lowest Score, then the lowest index. */
+		FORCEINLINE bool IsBetterThan( const FCandidate& Other ) const
+		{
+			if( Index == INDEX_NONE || Other.Index == INDEX_NONE )
+			{
+				return Other.Index == INDEX_NONE && Index != INDEX_NONE;
+			}
+			if( Tier != Other.Tier )
+			{
+				return Tier < Other.Tier;
+			}
+			return Score < Other.Score || ( Score == Other.Score && Index < Other.Index );
+		}
+
+		int32								Index;
+		int32								Tier;
+		float								Score;
+	};
+
+	/** @return How many tasks to split a search of NumEntries into.  1 means search serially. */
+	static int32							GetNumTasks( int32 NumEntries, int32 ParallelThreshold, int32 MaxTasks );
+
+	/** Scores the entries in [Begin, End), keeping the best in InOutBest. */
+	template<typename PolicyType, int32 Axis, int32 Sign>
+	static void								ScoreRange( const FNavigationSnapshot& Snapshot, int32 FromIndex, const PolicyType& Policy, int32 Begin, int32 End, FCandidate& InOutBest )
+	{
+		const float* AlongPos = ( Axis == 0 ) ? Snapshot.CentreX.GetData() : Snapshot.CentreY.GetData();
+		const float* AcrossPos = ( Axis == 0 ) ? Snapshot.CentreY.GetData() : Snapshot.CentreX.GetData();
+		const float FromAlong = AlongPos[FromIndex];
+		const float FromAcross = AcrossPos[FromIndex];
+
+		int32 BestIndex = InOutBest.Index;
+		int32 BestTier = InOutBest.Tier;
+		float BestScore = InOutBest.Score;
+
+		for( int32 Index = Begin; Index < End; ++Index )
+		{
+			const float Along = ( AlongPos[Index] - FromAlong ) * Sign;
+			if( Along <= 0.f || Index == FromIndex || !Snapshot.IsNavigable( Index ) )
+			{
+				continue;
+			}
+
+			int32 Tier;
+			float Score;
+			if( Policy.Score( Along, FMath::Abs( AcrossPos[Index] - FromAcross ), Tier, Score ) &&
+				( Tier < BestTier || ( Tier == BestTier && Score < BestScore ) ) )
+			{
+				BestIndex = Index;
+				BestTier = Tier;
+				BestScore = Score;
+			}
+		}
+
+		InOutBest.Index = BestIndex;
+		InOutBest.Tier = BestTier;
+		InOutBest.Score = BestScore;
+	}
+
+	/** Picks the compiled search for the direction. */
+	template<typename PolicyType>
+	static int32							FindNeighbourInDirection( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction, const PolicyType& Policy,
+																	  int32 ParallelThreshold, int32 MaxTasks );
+};
@@ -0,0 +1,91 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* A packed, struct-of-arrays copy of the geometry of a layer's navigable Widgets.
+* Captured once per layout change, so searching never has to touch the Widgets themselves,
+* and laid out so the scoring kernel can test four candidates per instruction.
+*
+* Directions are indexed in the same order as ENavDirection: Up, Down, Left, Right.
+*/
+class CONTROLLERNAVIGATIONCORE_API FNavigationSnapshot
+{
+public:
+	/** Per-entry flags. */
+	enum EFlags : uint8
+	{
+		/** We are allowed to navigate TO this entry, i.e. it isn't a ScrollBox. */
+		Flag_Target			= 1 << 0,
+
+		/** The Widget has been laid out, so its geometry means something. */
+		Flag_HasGeometry	= 1 << 1,
+	};
+
+	/** The number of entries the scoring kernel tests at once. */
+	enum { BlockSize = 4 };
+
+	FNavigationSnapshot();
+
+	/**
+	* Empties the snapshot, keeping its memory.
+	* @param ExpectedNum The number of entries about to be added.
+	*/
+	void									Reset( int32 ExpectedNum = 0 );
+
+	/**
+	* Adds an entry.
+	* @param Centre The centre of the Widget, in absolute (desktop) space.
+	* @param HalfSize Half of the Widget's size.
+	* @param EntryFlags Any combination of EFlags.
+	*/
+	void									Add( const FVector2D& Centre, const FVector2D& HalfSize, uint8 EntryFlags );
+
+	/** Pads the arrays out to a whole number of blocks.  Call after the last Add(). */
+	void									Finalize();
+
+	/** @return The number of bytes allocated by the snapshot. */
+	SIZE_T									GetAllocatedSize() const;
+
+	/** @return The number of entries, not including padding. */
+	int32									Num() const { return NumEntries; }
+
+	/** @return The centre of the entry, in absolute (desktop) space. */
+	FVector2D								GetCentre( int32 Index ) const { return FVector2D( CentreX[Index], CentreY[Index] ); }
+
+	/** @return Half the size of the entry. */
+	FVector2D								GetHalfSize( int32 Index ) const { return FVector2D( HalfWidth[Index], HalfHeight[Index] ); }
+
+	/** @return True if the entry is a laid out target, i.e. somewhere we can actually navigate to. */
+	bool									IsNavigable( int32 Index ) const
+	{
+		return ( Flags[Index] & ( Flag_Target | Flag_HasGeometry ) ) == ( Flag_Target | Flag_HasGeometry );
+	}
+
+	/**
+	* Makes the same choice as the original per-Widget Linear search: candidates are visited in order and
+	* replace the current choice if they are no further away in the direction of travel and not noticeably
+	* further across it.  Left and Right only start on a candidate within NavigationThreshold across.
+	*
+	* @param FromIndex The index of the entry we are moving from.
+	* @param Direction The direction to move in (Up, Down, Left, Right).
+	* @param NavigationThreshold The configured Navigation Threshold.
+	* @param bEuclideanDown If true, Down picks the nearest candidate by straight line distance instead.
+	* @return The index of the entry to move to, or INDEX_NONE if there isn't one.
+	*/
+	int32									FindLinearNeighbour( int32 FromIndex, int32 Direction, float NavigationThreshold, bool bEuclideanDown ) const;
+
+	/** The packed geometry and flags, one entry per Widget, padded to a whole number of blocks. */
+	TArray<float>							CentreX;
+	TArray<float>							CentreY;
+	TArray<float>							HalfWidth;
+	TArray<float>							HalfHeight;
+	TArray<uint8>							Flags;
+
+private:
+
+	/** The number of real (not padding) entries. */
+	int32									NumEntries;
+};
@@ -0,0 +1,30 @@
+// (C) Gaslight Games Ltd, 2017-2019.  All rights reserved.
+
+using UnrealBuildTool;
+using System.Collections.Generic;
+
+/**
+* A console program that checks ControllerNavigationCore's searches agree with each other, without the engine, UMG or
+* a Widget in sight.  Build it like any other target, i.e. "Build ControllerNavigationCoreTests Linux Development
+* -Project=GamepadUI.uproject", then run it: it exits with 0 if every check passes.
+*/
+[SupportedPlatforms( UnrealPlatformClass.Desktop )]
+public class ControllerNavigationCoreTestsTarget : TargetRules
+{
+	public ControllerNavigationCoreTestsTarget( TargetInfo Target ) : base( Target )
+	{
+		Type = TargetType.Program;
+		LinkType = TargetLinkType.Monolithic;
+		LaunchModuleName = "ControllerNavigationCoreTests";
+
+		// Only Core, and the navigation algorithms themselves.
+		bBuildDeveloperTools = false;
+		bCompileAgainstEngine = false;
+		bCompileAgainstCoreUObject = false;
+		bCompileICU = false;
+		bUseMallocProfiler = false;
+		bIsBuildingConsoleApplication = true;
+
+		EnablePlugins.Add( "ControllerNavigation" );
+	}
+}
@@ -0,0 +1,23 @@
+// (C) Gaslight Games Ltd, 2017-2019.  All rights reserved.
+
+using UnrealBuildTool;
+
+public class ControllerNavigationCoreTests : ModuleRules
+{
+	public ControllerNavigationCoreTests( ReadOnlyTargetRules Target ) : base( Target )
+	{
+		// For the program's main(), see RequiredProgramMainCPPInclude.h.
+		PublicIncludePaths.Add( "Runtime/Launch/Public" );
+		PrivateIncludePaths.Add( "Runtime/Launch/Private" );
+
+		// Nothing that knows about Widgets, so this also checks ControllerNavigationCore stays Core-only.
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Projects",
+				"ControllerNavigationCore",
+			}
+			);
+	}
+}
@@ -0,0 +1,664 @@
+// Gaslight Games Ltd, (C) 2016-2019. All rights reserved.
+
+#include "RequiredProgramMainCPPInclude.h"
+
+#include "Math/RandomStream.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+#include "NavigationLayout.h"
+
+DEFINE_LOG_CATEGORY_STATIC( LogControllerNavigationCoreTests, Log, All );
+
+IMPLEMENT_APPLICATION( ControllerNavigationCoreTests, "ControllerNavigationCoreTests" );
+
+namespace
+{
+	/** The number of directions, in the same order as ENavDirection: Up, Down, Left, Right. */
+	const int32 NumDirections = FNavigationGraph::NumDirections;
+
+	/** The scorings handled by FNavigationScoring, i.e. every one but Legacy. */
+	const ENavigationLayoutScoring ParallelScorings[] =
+	{
+		ENavigationLayoutScoring::NearestCentre,
+		ENavigationLayoutScoring::AxisAligned,
+		ENavigationLayoutScoring::ConeWeighted
+	};
+
+	/** The Navigation Threshold used by the AxisAligned scoring, the same as the Navigator's default. */
+	const float NavigationThreshold = 10.f;
+
+	/**
+	* Fills the layout with NumEntries rects, the same every run for the same Seed.  They sit on a coarse grid, so plenty
+	* share a row, column or even centre and the tie-breaks get checked too, and some aren't targets or haven't been laid out.
+	*/
+	void MakeLayout( FNavigationLayout& Layout, int32 NumEntries, int32 Seed, bool bBuildGraph, bool bBackgroundGraph = false )
+	{
+		FRandomStream Random( Seed );
+		const int32 NumColumns = FMath::Max( FMath::CeilToInt( FMath::Sqrt( (float)NumEntries ) ), 1 );
+
+		Layout.Reset( NumEntries );
+		for( int32 i = 0; i < NumEntries; ++i )
+		{
+			const FVector2D Centre( Random.RandRange( 0, NumColumns ) * 60.f, Random.RandRange( 0, NumColumns ) * 40.f );
+			const FVector2D HalfSize( Random.RandRange( 10, 40 ), Random.RandRange( 10, 20 ) );
+
+			uint8 Flags = 0;
+			if( Random.FRand() > .1f )
+			{
+				Flags |= FNavigationSnapshot::Flag_Target;
+			}
+			if( Random.FRand() > .05f )
+			{
+				Flags |= FNavigationSnapshot::Flag_HasGeometry;
+			}
+
+			Layout.Add( Centre, HalfSize, Flags );
+		}
+
+		Layout.Build( bBuildGraph, bBackgroundGraph );
+	}
+
+	/** @return The entry the Spatial Index should pick, found by scoring every entry, the way its doc comment describes. */
+	int32 FindReferenceNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction )
+	{
+		const FVector2D DirectionVector = FNavigationGraph::GetDirectionVector( Direction );
+		const bool bHorizontal = FMath::Abs( DirectionVector.X ) > FMath::Abs( DirectionVector.Y );
+		const float Step = bHorizontal ? DirectionVector.X : DirectionVector.Y;
+		const FVector2D From = Snapshot.GetCentre( FromIndex );
+
+		float BestScore = MAX_flt;
+		int32 BestIndex = INDEX_NONE;
+		for( int32 i = 0; i < Snapshot.Num(); ++i )
+		{
+			if( i == FromIndex || !Snapshot.IsNavigable( i ) )
+			{
+				continue;
+			}
+
+			const FVector2D Delta = Snapshot.GetCentre( i ) - From;
+			const float Along = ( bHorizontal ? Delta.X : Delta.Y ) * Step;
+			if( Along <= 0.f )
+			{
+				continue;
+			}
+
+			// Visited in index order, so ties already go to the lowest index.
+			const float Score = Along + FNavigationGrid::OffAxisWeight * FMath::Abs( bHorizontal ? Delta.Y : Delta.X );
+			if( Score < BestScore )
+			{
+				BestScore = Score;
+				BestIndex = i;
+			}
+		}
+
+		return BestIndex;
+	}
+
+	/** @return The query for moving from FromIndex in Direction. */
+	FNavigationQuery MakeQuery( int32 FromIndex, int32 Direction, ENavigationLayoutSearch Search )
+	{
+		FNavigationQuery Query;
+		Query.FromIndex = FromIndex;
+		Query.Direction = Direction;
+		Query.Search = Search;
+		Query.NavigationThreshold = NavigationThreshold;
+		return Query;
+	}
+
+	/** Logs a mismatch, and returns false, so checks read as "bPassed &= Expect( ... )". */
+	bool Expect( bool bCondition, const TCHAR* Test, const TCHAR* What, int32 FromIndex, int32 Direction, int32 Expected, int32 Actual )
+	{
+		if( !bCondition )
+		{
+			UE_LOG( LogControllerNavigationCoreTests, Error, TEXT( "%s: %s from %d in direction %d picked %d, expected %d." ),
+					Test, What, FromIndex, Direction, Actual, Expected );
+		}
+
+		return bCondition;
+	}
+
+	/** The Spatial Index, and the Neighbour Graph built from it, pick the same entries as scoring every entry does. */
+	bool TestSpatialIndex()
+	{
+		bool bPassed = true;
+		for( const int32 NumEntries : { 1, 7, 100, 1000 } )
+		{
+			FNavigationLayout Layout;
+			MakeLayout( Layout, NumEntries, NumEntries, true );
+
+			for( int32 From = 0; From < Layout.Num(); ++From )
+			{
+				for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+				{
+					const int32 Expected = FindReferenceNeighbour( Layout.GetSnapshot(), From, Direction );
+					const int32 FromGrid = Layout.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::SpatialIndex ) );
+					const int32 FromGraph = Layout.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+
+					bPassed &= Expect( FromGrid == Expected, TEXT( "SpatialIndex" ), TEXT( "The Spatial Index" ), From, Direction, Expected, FromGrid );
+					bPassed &= Expect( FromGraph == Expected, TEXT( "SpatialIndex" ), TEXT( "The Neighbour Graph" ), From, Direction, Expected, FromGraph );
+				}
+			}
+		}
+
+		return bPassed;
+	}
+
+	/** Splitting the scoring over 1, 2, 4 or 8 tasks always picks what the serial search picks. */
+	bool TestParallelScoring()
+	{
+		const int32 NumEntries = FNavigationScoring::MinEntriesPerTask * 8;
+		const int32 NumFroms = 256;
+
+		FNavigationLayout Layout;
+		MakeLayout( Layout, NumEntries, 8, false );
+		const FNavigationSnapshot& Snapshot = Layout.GetSnapshot();
+
+		bool bPassed = true;
+		for( const ENavigationLayoutScoring Scoring : ParallelScorings )
+		{
+			for( int32 i = 0; i < NumFroms; ++i )
+			{
+				const int32 From = ( i * NumEntries ) / NumFroms;
+				for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+				{
+					const int32 Expected = FNavigationScoring::FindNeighbour( Snapshot, From, Direction, Scoring, NavigationThreshold, MAX_int32 );
+					for( const int32 MaxTasks : { 1, 2, 4, 8 } )
+					{
+						const int32 Actual = FNavigationScoring::FindNeighbour( Snapshot, From, Direction, Scoring, NavigationThreshold, 0, MaxTasks );
+						bPassed &= Expect( Actual == Expected, TEXT( "ParallelScoring" ), *FString::Printf( TEXT( "Scoring %d over %d tasks" ), (int32)Scoring, MaxTasks ),
+										   From, Direction, Expected, Actual );
+					}
+				}
+			}
+		}
+
+		return bPassed;
+	}
+
+	/** A Neighbour Graph built in the background is the same as one built straight away, and is searched Linearly until then. */
+	bool TestBackgroundGraph()
+	{
+		const int32 NumEntries = FNavigationLayout::MinEntriesForBackgroundGraph * 4;
+
+		FNavigationLayout Foreground;
+		MakeLayout( Foreground, NumEntries, 4, true );
+
+		FNavigationLayout Background;
+		MakeLayout( Background, NumEntries, 4, true, true );
+
+		bool bPassed = true;
+
+		// Until it is published, the graph search must fall back to the Linear search, not read a half built graph.
+		if( !Background.HasGraph() )
+		{
+			const int32 Expected = Background.FindTarget( MakeQuery( 0, 1, ENavigationLayoutSearch::Linear ) );
+			const int32 Actual = Background.FindTarget( MakeQuery( 0, 1, ENavigationLayoutSearch::NeighbourGraph ) );
+			bPassed &= Expect( Actual == Expected, TEXT( "BackgroundGraph" ), TEXT( "The unpublished graph" ), 0, 1, Expected, Actual );
+		}
+
+		Background.WaitForGraph();
+		if( !Background.HasGraph() )
+		{
+			UE_LOG( LogControllerNavigationCoreTests, Error, TEXT( "BackgroundGraph: WaitForGraph() didn't publish the graph." ) );
+			return false;
+		}
+
+		for( int32 From = 0; From < NumEntries; ++From )
+		{
+			for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+			{
+				const int32 Expected = Foreground.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+				const int32 Actual = Background.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+				bPassed &= Expect( Actual == Expected, TEXT( "BackgroundGraph" ), TEXT( "The background graph" ), From, Direction, Expected, Actual );
+			}
+		}
+
+		return bPassed;
+	}
+
+	/** Copied and moved layouts answer every query the same as the original, including one moved mid-build. */
+	bool TestCopyAndMove()
+	{
+		const int32 NumEntries = FNavigationLayout::MinEntriesForBackgroundGraph * 2;
+
+		FNavigationLayout Original;
+		MakeLayout( Original, NumEntries, 2, true );
+
+		FNavigationLayout Building;
+		MakeLayout( Building, NumEntries, 2, true, true );
+
+		FNavigationLayout Copied( Original );
+		FNavigationLayout Moved( MoveTemp( Building ) );
+		Moved.WaitForGraph();
+
+		bool bPassed = true;
+		for( int32 From = 0; From < NumEntries; ++From )
+		{
+			for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+			{
+				const int32 Expected = Original.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+				const int32 FromCopy = Copied.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+				const int32 FromMove = Moved.FindTarget( MakeQuery( From, Direction, ENavigationLayoutSearch::NeighbourGraph ) );
+
+				bPassed &= Expect( FromCopy == Expected, TEXT( "CopyAndMove" ), TEXT( "The copy" ), From, Direction, Expected, FromCopy );
+				bPassed &= Expect( FromMove == Expected, TEXT( "CopyAndMove" ), TEXT( "The moved layout" ), From, Direction, Expected, FromMove );
+			}
+		}
+
+		return bPassed;
+	}
+
+	/** The kinds of layout the Legacy scoring is checked over. */
+	enum class ELegacyLayout : uint8
+	{
+		/** Rows of differing lengths, of rects of differing widths, with some centres sat on zero. */
+		Ragged,
+
+		/** Large rects piled on top of each other, some sharing a centre. */
+		Overlapping,
+
+		/** A coarse, square lattice, so distances along, across and in a straight line often tie. */
+		Tied
+	};
+
+	/** Fills the layout with NumEntries rects of the passed kind, the same every run for the same Seed.  Some aren't targets. */
+	void MakeLegacyLayout( FNavigationLayout& Layout, ELegacyLayout Kind, int32 NumEntries, int32 Seed )
+	{
+		FRandomStream Random( Seed );
+		const auto AddRect = [ &Layout, &Random ]( const FVector2D& Centre, const FVector2D& HalfSize )
+		{
+			const uint8 Flags = ( Random.FRand() > .1f ) ? FNavigationSnapshot::Flag_Target | FNavigationSnapshot::Flag_HasGeometry : FNavigationSnapshot::Flag_HasGeometry;
+			Layout.Add( Centre, HalfSize, Flags );
+		};
+
+		Layout.Reset( NumEntries );
+		switch( Kind )
+		{
+			case ELegacyLayout::Ragged:
+			{
+				// The first row, and the first rect of some rows, are centred on zero, which the Legacy scoring never moves to.
+				float Y = 0.f;
+				while( Layout.Num() < NumEntries )
+				{
+					const int32 NumInRow = FMath::Min( Random.RandRange( 1, 12 ), NumEntries - Layout.Num() );
+					float X = ( Random.FRand() < .2f ) ? 0.f : Random.FRandRange( 0.f, 120.f );
+					for( int32 i = 0; i < NumInRow; ++i )
+					{
+						const FVector2D HalfSize( Random.FRandRange( 15.f, 120.f ), 20.f );
+						AddRect( FVector2D( X, Y ), HalfSize );
+						X += HalfSize.X * 2.f + Random.FRandRange( 0.f, 40.f );
+					}
+					Y += 40.f + Random.FRandRange( 10.f, 40.f );
+				}
+				break;
+			}
+
+			case ELegacyLayout::Overlapping:
+			{
+				while( Layout.Num() < NumEntries )
+				{
+					const bool bShareCentre = ( Layout.Num() > 0 && Random.FRand() < .2f );
+					const FVector2D Centre = bShareCentre ? Layout.GetSnapshot().GetCentre( Layout.Num() - 1 ) : FVector2D( Random.FRandRange( 0.f, 200.f ), Random.FRandRange( 0.f, 150.f ) );
+					AddRect( Centre, FVector2D( Random.FRandRange( 20.f, 80.f ), Random.FRandRange( 10.f, 40.f ) ) );
+				}
+				break;
+			}
+
+			default:
+			{
+				while( Layout.Num() < NumEntries )
+				{
+					AddRect( FVector2D( Random.RandRange( -4, 4 ) * 40.f, Random.RandRange( -4, 4 ) * 40.f ), FVector2D( 15.f, 15.f ) );
+				}
+				break;
+			}
+		}
+
+		Layout.Build( false );
+	}
+
+	/**
+	* The baseline Navigate()'s scoring, ported from its per-Widget loop (NAVIGATOR_MECHANISM 1) quirks and all: Down picks
+	* by straight line distance, Left and Right only apply the threshold to the first candidate, and nothing centred on zero
+	* along the direction of travel is ever picked.  Non-targets stand in for the ScrollBoxes it skipped.
+	* @return The entry the baseline would have moved to, or INDEX_NONE.
+	*/
+	int32 FindLegacyNeighbour( const FNavigationSnapshot& Snapshot, int32 FromIndex, int32 Direction, float NavigationThreshold )
+	{
+		const FVector2D CurrentWidgetPos = Snapshot.GetCentre( FromIndex );
+
+		int32 NextWidget = INDEX_NONE;
+		FVector2D CurrentTargetWidgetPos = FVector2D::ZeroVector;
+
+		for( int32 j = 0; j < Snapshot.Num(); ++j )
+		{
+			if( j == FromIndex || ( Snapshot.Flags[j] & FNavigationSnapshot::Flag_Target ) == 0 )
+			{
+				continue;
+			}
+
+			const FVector2D LoopWidgetPos = Snapshot.GetCentre( j );
+			const FVector2D NextWidgetPos = ( NextWidget != INDEX_NONE ) ? Snapshot.GetCentre( NextWidget ) : FVector2D::ZeroVector;
+
+			switch( Direction )
+			{
+				case 0:
+				{
+					if( LoopWidgetPos.Y != 0 && LoopWidgetPos.Y < CurrentWidgetPos.Y )
+					{
+						if( NextWidget == INDEX_NONE )
+						{
+							NextWidget = j;
+						}
+						else
+						{
+							const float VertDistCurToNext = CurrentWidgetPos.Y - NextWidgetPos.Y;
+							const float VertDistCurToLoop = CurrentWidgetPos.Y - LoopWidgetPos.Y;
+							if( VertDistCurToLoop <= VertDistCurToNext && VertDistCurToLoop > 0 && VertDistCurToNext > 0 )
+							{
+								const float HorizDistCurToNext = FMath::Abs( CurrentWidgetPos.X - NextWidgetPos.X );
+								const float HorizDistCurToLoop = FMath::Abs( CurrentWidgetPos.X - LoopWidgetPos.X );
+								if( HorizDistCurToLoop - NavigationThreshold < HorizDistCurToNext || HorizDistCurToLoop + NavigationThreshold < HorizDistCurToNext )
+								{
+									NextWidget = j;
+								}
+							}
+						}
+					}
+					break;
+				}
+
+				case 1:
+				{
+					if( LoopWidgetPos.Y != 0 && LoopWidgetPos.Y > CurrentWidgetPos.Y )
+					{
+						if( NextWidget == INDEX_NONE )
+						{
+							CurrentTargetWidgetPos = LoopWidgetPos;
+							NextWidget = j;
+						}
+						else
+						{
+							const float DistCurToTarget = ( CurrentWidgetPos - CurrentTargetWidgetPos ).Size();
+							const float DistCurToLoop = ( CurrentWidgetPos - LoopWidgetPos ).Size();
+							if( DistCurToLoop < DistCurToTarget && DistCurToLoop > 0 && DistCurToTarget > 0 )
+							{
+								CurrentTargetWidgetPos = LoopWidgetPos;
+								NextWidget = j;
+							}
+						}
+					}
+					break;
+				}
+
+				case 2:
+				{
+					if( LoopWidgetPos.X != 0 && LoopWidgetPos.X < CurrentWidgetPos.X )
+					{
+						if( NextWidget == INDEX_NONE )
+						{
+							if( LoopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && LoopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
+							{
+								NextWidget = j;
+							}
+						}
+						else
+						{
+							const float HorizDistCurToNext = CurrentWidgetPos.X - NextWidgetPos.X;
+							const float HorizDistCurToLoop = CurrentWidgetPos.X - LoopWidgetPos.X;
+							if( HorizDistCurToLoop <= HorizDistCurToNext && HorizDistCurToLoop > 0 && HorizDistCurToNext > 0 )
+							{
+								const float VertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - NextWidgetPos.Y );
+								const float VertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - LoopWidgetPos.Y );
+								if( VertDistCurToLoop - NavigationThreshold < VertDistCurToNext || VertDistCurToLoop + NavigationThreshold < VertDistCurToNext )
+								{
+									NextWidget = j;
+								}
+							}
+						}
+					}
+					break;
+				}
+
+				default:
+				{
+					if( LoopWidgetPos.X != 0 && LoopWidgetPos.X > CurrentWidgetPos.X )
+					{
+						if( NextWidget == INDEX_NONE )
+						{
+							if( LoopWidgetPos.Y < CurrentWidgetPos.Y + NavigationThreshold && LoopWidgetPos.Y > CurrentWidgetPos.Y - NavigationThreshold )
+							{
+								NextWidget = j;
+							}
+						}
+						else
+						{
+							const float HorizDistNextToCur = NextWidgetPos.X - CurrentWidgetPos.X;
+							const float HorizDistLoopToCur = LoopWidgetPos.X - CurrentWidgetPos.X;
+							if( HorizDistLoopToCur <= HorizDistNextToCur && HorizDistLoopToCur > 0 && HorizDistNextToCur > 0 )
+							{
+								const float VertDistCurToNext = FMath::Abs( CurrentWidgetPos.Y - NextWidgetPos.Y );
+								const float VertDistCurToLoop = FMath::Abs( CurrentWidgetPos.Y - LoopWidgetPos.Y );
+								if( VertDistCurToLoop - NavigationThreshold < VertDistCurToNext || VertDistCurToLoop + NavigationThreshold < VertDistCurToNext )
+								{
+									NextWidget = j;
+								}
+							}
+						}
+					}
+					break;
+				}
+			}
+		}
+
+		return NextWidget;
+	}
+
+	/** The vectorised Legacy scoring makes exactly the baseline Navigate()'s choices, in every direction. */
+	bool TestLegacyScoring()
+	{
+		const TCHAR* KindNames[] = { TEXT( "Ragged" ), TEXT( "Overlapping" ), TEXT( "Tied" ) };
+		const float Thresholds[] = { 0.f, NavigationThreshold, 45.f };
+
+		bool bPassed = true;
+		FNavigationLayout Layout;
+		for( int32 Kind = 0; Kind < (int32)ARRAY_COUNT( KindNames ); ++Kind )
+		{
+			for( const int32 NumEntries : { 1, 2, 5, 37, 256 } )
+			{
+				for( int32 Seed = 0; Seed < 3; ++Seed )
+				{
+					MakeLegacyLayout( Layout, (ELegacyLayout)Kind, NumEntries, NumEntries * 3 + Seed );
+					const FNavigationSnapshot& Snapshot = Layout.GetSnapshot();
+
+					for( const float Threshold : Thresholds )
+					{
+						const FString What = FString::Printf( TEXT( "%s layout %d, seed %d, threshold %.0f" ), KindNames[Kind], NumEntries, Seed, Threshold );
+						for( int32 From = 0; From < Snapshot.Num(); ++From )
+						{
+							for( int32 Direction = 0; Direction < NumDirections; ++Direction )
+							{
+								const int32 Expected = FindLegacyNeighbour( Snapshot, From, Direction, Threshold );
+								const int32 Actual = Snapshot.FindLinearNeighbour( From, Direction, Threshold, true );
+								bPassed &= Expect( Actual == Expected, TEXT( "LegacyScoring" ), *What, From, Direction, Expected, Actual );
+							}
+						}
+					}
+				}
+			}
+		}
+
+		return bPassed;
+	}
+
+	/** Width, height and spacing of a rect in the timed layouts, the same as the benchmark's Buttons. */
+	const FVector2D TimingRectSize( 120.f, 40.f );
+	const float TimingRectSpacing = 10.f;
+
+	/** The number of untimed, and timed, searches made per layout and search. */
+	const int32 NumWarmUpSearches = 64;
+	const int32 NumTimedSearches = 2000;
+
+	/** Fills the layout with NumEntries evenly spaced rects, as square as it will go. */
+	void BuildTimingGrid( FNavigationLayout& Layout, int32 NumEntries )
+	{
+		const int32 NumColumns = FMath::CeilToInt( FMath::Sqrt( (float)NumEntries ) );
+
+		Layout.Reset( NumEntries );
+		for( int32 i = 0; i < NumEntries; ++i )
+		{
+			const FVector2D TopLeft( ( i % NumColumns ) * ( TimingRectSize.X + TimingRectSpacing ), ( i / NumColumns ) * ( TimingRectSize.Y + TimingRectSpacing ) );
+			Layout.Add( TopLeft + TimingRectSize * .5f, TimingRectSize * .5f, FNavigationSnapshot::Flag_Target | FNavigationSnapshot::Flag_HasGeometry );
+		}
+
+		Layout.Build( true );
+	}
+
+	/** Fills the layout with NumEntries rects in rows of differing lengths, of differing widths, so nothing lines up. */
+	void BuildTimingRagged( FNavigationLayout& Layout, int32 NumEntries )
+	{
+		FRandomStream Random( 5678 );
+
+		Layout.Reset( NumEntries );
+		float Y = 0.f;
+		while( Layout.Num() < NumEntries )
+		{
+			float X = Random.FRandRange( 0.f, TimingRectSize.X );
+			const int32 NumInRow = FMath::Min( Random.RandRange( 1, 20 ), NumEntries - Layout.Num() );
+			for( int32 i = 0; i < NumInRow; ++i )
+			{
+				const FVector2D Size( Random.FRandRange( TimingRectSize.X * .25f, TimingRectSize.X * 2.f ), TimingRectSize.Y );
+				Layout.Add( FVector2D( X, Y ) + Size * .5f, Size * .5f, FNavigationSnapshot::Flag_Target | FNavigationSnapshot::Flag_HasGeometry );
+				X += Size.X + Random.FRandRange( 0.f, TimingRectSpacing * 4.f );
+			}
+			Y += TimingRectSize.Y + Random.FRandRange( TimingRectSpacing, TimingRectSpacing * 4.f );
+		}
+
+		Layout.Build( true );
+	}
+
+	/**
+	* Times FindTarget() walking the layout with the passed search, and scoring, then logs its percentiles.
+	* Every search makes the same sequence of moves, so runs, and searches, can be compared.
+	*/
+	void TimeSearch( const TCHAR* LayoutName, const FNavigationLayout& Layout, const TCHAR* SearchName, ENavigationLayoutSearch Search, ENavigationLayoutScoring Scoring )
+	{
+		FRandomStream Random( 1234 );
+		int32 From = 0;
+		const auto Move = [ & ]()
+		{
+			FNavigationQuery Query = MakeQuery( From, Random.RandRange( 0, NumDirections - 1 ), Search );
+			Query.Scoring = Scoring;
+
+			const int32 Target = Layout.FindTarget( Query );
+			From = ( Target != INDEX_NONE ) ? Target : From;
+		};
+
+		for( int32 i = 0; i < NumWarmUpSearches; ++i )
+		{
+			Move();
+		}
+
+		TArray<double> Microseconds;
+		Microseconds.Reserve( NumTimedSearches );
+		for( int32 i = 0; i < NumTimedSearches; ++i )
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Move();
+			Microseconds.Add( FPlatformTime::ToMilliseconds64( FPlatformTime::Cycles64() - StartCycles ) * 1000.0 );
+		}
+
+		Microseconds.Sort();
+		const auto Percentile = [ &Microseconds ]( float Fraction )
+		{
+			return Microseconds[FMath::Min( FMath::FloorToInt( Fraction * Microseconds.Num() ), Microseconds.Num() - 1 )];
+		};
+
+		UE_LOG( LogControllerNavigationCoreTests, Display, TEXT( "%-12s %7d %-16s %10.2f %10.2f %10.2f" ),
+				LayoutName, Layout.Num(), SearchName, Percentile( .5f ), Percentile( .9f ), Percentile( .99f ) );
+	}
+
+	/** Times every search, and scoring, over grids of 10 to 10,000 rects and a ragged layout, without the Navigator or Slate. */
+	void RunTimings()
+	{
+		struct FTimedSearch
+		{
+			const TCHAR*				Name;
+			ENavigationLayoutSearch		Search;
+			ENavigationLayoutScoring	Scoring;
+		};
+
+		const FTimedSearch Searches[] =
+		{
+			{ TEXT( "Linear" ),			ENavigationLayoutSearch::Linear,			ENavigationLayoutScoring::Legacy },
+			{ TEXT( "NearestCentre" ),	ENavigationLayoutSearch::Linear,			ENavigationLayoutScoring::NearestCentre },
+			{ TEXT( "AxisAligned" ),	ENavigationLayoutSearch::Linear,			ENavigationLayoutScoring::AxisAligned },
+			{ TEXT( "ConeWeighted" ),	ENavigationLayoutSearch::Linear,			ENavigationLayoutScoring::ConeWeighted },
+			{ TEXT( "SpatialIndex" ),	ENavigationLayoutSearch::SpatialIndex,		ENavigationLayoutScoring::Legacy },
+			{ TEXT( "NeighbourGraph" ),	ENavigationLayoutSearch::NeighbourGraph,	ENavigationLayoutScoring::Legacy }
+		};
+
+		UE_LOG( LogControllerNavigationCoreTests, Display, TEXT( "%-12s %7s %-16s %10s %10s %10s" ),
+				TEXT( "Layout" ), TEXT( "Rects" ), TEXT( "Search" ), TEXT( "p50 (us)" ), TEXT( "p90 (us)" ), TEXT( "p99 (us)" ) );
+
+		FNavigationLayout Layout;
+		for( const int32 NumEntries : { 10, 100, 1000, 10000 } )
+		{
+			BuildTimingGrid( Layout, NumEntries );
+			const FString LayoutName = FString::Printf( TEXT( "Grid%d" ), NumEntries );
+			for( const FTimedSearch& Timed : Searches )
+			{
+				TimeSearch( *LayoutName, Layout, Timed.Name, Timed.Search, Timed.Scoring );
+			}
+		}
+
+		BuildTimingRagged( Layout, 1000 );
+		for( const FTimedSearch& Timed : Searches )
+		{
+			TimeSearch( TEXT( "Ragged" ), Layout, Timed.Name, Timed.Search, Timed.Scoring );
+		}
+	}
+}
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	GEngineLoop.PreInit( ArgC, ArgV );
+
+	// "ControllerNavigationCoreTests -Benchmark" times the searches instead of checking them.
+	if( FParse::Param( FCommandLine::Get(), TEXT( "Benchmark" ) ) )
+	{
+		RunTimings();
+		FEngineLoop::AppExit();
+		return 0;
+	}
+
+	struct FTest
+	{
+		const TCHAR*	Name;
+		bool			( *Run )();
+	};
+
+	const FTest Tests[] =
+	{
+		{ TEXT( "SpatialIndex" ),		&TestSpatialIndex },
+		{ TEXT( "ParallelScoring" ),	&TestParallelScoring },
+		{ TEXT( "BackgroundGraph" ),	&TestBackgroundGraph },
+		{ TEXT( "CopyAndMove" ),		&TestCopyAndMove },
+		{ TEXT( "LegacyScoring" ),		&TestLegacyScoring }
+	};
+
+	int32 NumFailed = 0;
+	for( const FTest& Test : Tests )
+	{
+		const bool bPassed = Test.Run();
+		UE_LOG( LogControllerNavigationCoreTests, Display, TEXT( "%-16s %s" ), Test.Name, bPassed ? TEXT( "Passed" ) : TEXT( "FAILED" ) );
+		NumFailed += bPassed ? 0 : 1;
+	}
+
+	const int32 NumTests = ARRAY_COUNT( Tests );
+	UE_LOG( LogControllerNavigationCoreTests, Display, TEXT( "%d of %d tests passed." ), NumTests - NumFailed, NumTests );
+
+	FEngineLoop::AppExit();
+	return ( NumFailed == 0 ) ? 0 : 1;
+}